@@ -275,6 +275,8 @@ recycle: native [
 	/ballast {Trigger for auto-recycle (memory used)}
 	size [integer!]
 	/torture {Constant recycle (for internal debugging)}
+	/budget {Free unused series in slices between evaluations}
+	limit [integer!] {Series freed per slice (0 frees all at once)}
 ]
 
 reduce: native [
@@ -330,6 +332,13 @@ trace: native [
 ;	/stack {Show stack index}
 ]
 
+profile: native [
+	{Profiles function calls: counts and inclusive/exclusive times per label.}
+	mode [logic!] {ON clears prior results and starts, OFF stops}
+	/report {Return block of [label calls inclusive exclusive] blocks}
+	/stacks {Return collapsed stacks text (for flamegraph tools)}
+]
+
 trap: native [
 	{Tries to DO a block, trapping error as return value (if one is raised).}
 	block [block!]
@@ -267,6 +267,9 @@ standard: context [
 	port-spec-net: make port-spec-head [
 		host: none
 		port-id: 80
+		transfer-size:	; max bytes per send or receive (default 32000)
+		send-buffer:	; socket buffer sizes (default set by the OS)
+		receive-buffer:
 			none
 	]
 
@@ -282,6 +285,16 @@ standard: context [
 		mask: [all]
 	]
 
+	port-spec-zlib: make port-spec-head [
+		gzip: false	; gzip envelope (as COMPRESS/GZIP)
+		only: false	; no envelope (as COMPRESS/ONLY)
+	]
+
+	port-spec-checksum: make port-spec-head [
+		method: 'sha1	; any CHECKSUM/METHOD word
+		key: none	; for an HMAC (as CHECKSUM/KEY)
+	]
+
 	file-info: context [
 		name:
 		size:
@@ -321,6 +334,9 @@ standard: context [
 		made-blocks:
 		made-objects:
 		recycles:
+		minor-recycles:
+		minor-recycle-time:
+		major-recycle-time:
 			none
 	]
 
@@ -185,6 +185,9 @@ udp
 clipboard
 serial
 signal
+deflate
+inflate
+checksum
 
 ; Serial parameters
 ; Parity
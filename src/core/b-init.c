@@ -179,33 +179,135 @@ static	BOOT_BLK *Boot_Block;
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Boot_Image_Count(const REBYTE **bp)
+/*
+**		Read a count (or index) from the boot image.  It is stored 7
+**		bits at a time, low bits first, with the top bit set on every
+**		byte but the last.
+**
+***********************************************************************/
+{
+	REBCNT n = 0;
+	REBCNT shift = 0;
+
+	while (**bp & 0x80) {
+		n |= cast(REBCNT, *(*bp)++ & 0x7f) << shift;
+		shift += 7;
+	}
+	n |= cast(REBCNT, *(*bp)++) << shift;
+
+	return n;
+}
+
+
+/***********************************************************************
+**
+*/	static const REBYTE *Load_Boot_Value(REBVAL *out, const REBYTE *bp, const REBCNT *syms)
+/*
+**		Make a value from the boot image, returning the position just
+**		past it.  Each value starts with its REB_XXX type (plus 0x80
+**		if it had a newline before it), followed by:
+**
+**			any-word: index of its spelling in the image's word table
+**			any-array: count of values, then each of the values
+**			string: length of the UTF-8 and the UTF-8 itself
+**			integer: 8 bytes, most significant first
+**			others: length of the molded value, the mold and a NUL,
+**				which is handed to the scanner (Scan_Value)
+**
+**		The image is written by make-boot.r.
+**
+***********************************************************************/
+{
+	enum Reb_Kind type = cast(enum Reb_Kind, *bp & 0x7f);
+	REBFLG line = (*bp & 0x80) != 0;
+	REBCNT len;
+	REBCNT n;
+
+	bp++;
+
+	VAL_SET(out, type); // so the ANY_XXX() tests can be used
+
+	if (ANY_WORD(out))
+		Val_Init_Word_Unbound(out, type, syms[Boot_Image_Count(&bp)]);
+	else if (ANY_ARRAY(out)) {
+		REBSER *array;
+
+		len = Boot_Image_Count(&bp);
+		array = Make_Array(len);
+		for (n = 0; n < len; n++)
+			bp = Load_Boot_Value(BLK_SKIP(array, n), bp, syms);
+		SERIES_TAIL(array) = len;
+		TERM_ARRAY(array);
+
+		Val_Init_Series_Index(out, type, array, 0);
+	}
+	else if (IS_STRING(out)) {
+		len = Boot_Image_Count(&bp);
+		Val_Init_String(out, Append_UTF8(NULL, bp, len));
+		bp += len;
+	}
+	else if (IS_INTEGER(out)) {
+		REBU64 u = 0;
+		for (n = 0; n < 8; n++)
+			u = (u << 8) | *bp++;
+		SET_INTEGER(out, cast(REBI64, u));
+	}
+	else {
+		len = Boot_Image_Count(&bp);
+		if (!Scan_Value(out, bp, len) || VAL_TYPE(out) != type)
+			panic Error_0(RE_BOOT_DATA);
+		bp += len + 1;
+	}
+
+	if (line) VAL_SET_OPT(out, OPT_VALUE_LINE);
+
+	return bp;
+}
+
+
 /***********************************************************************
 **
 */	static void Load_Boot(void)
 /*
-**		Decompress and scan in the boot block structure.  Can
+**		Make the boot block structure from the boot image.  Can
 **		only be called at the correct point because it will
 **		create new symbols.
 **
+**		The image is the boot block already scanned by make-boot.r
+**		(it used to be compressed text, decompressed and scanned
+**		at every startup).  Its word table comes first, giving the
+**		spellings in the order the scanner would have met them, so
+**		they get the same symbol numbers.
+**
 ***********************************************************************/
 {
 	REBSER *boot;
-	REBSER *text;
+	REBVAL value;
+	REBCNT *syms;
+	REBCNT num_syms;
+	REBCNT len;
+	REBCNT n;
 
-	// Decompress binary data in Native_Specs to get the textual source
-	// of the function specs for the native routines into `boot` series.
-	//
-	// (Native_Specs array is in b-boot.c, auto-generated by make-boot.r)
+	// (Boot_Image array is in b-boot.c, auto-generated by make-boot.r)
+	const REBYTE *bp = Boot_Image;
 
-	text = Decompress(
-		Native_Specs, NAT_COMPRESSED_SIZE, NAT_UNCOMPRESSED_SIZE, FALSE, FALSE
-	);
+	num_syms = Boot_Image_Count(&bp);
+	syms = ALLOC_ARRAY(REBCNT, num_syms);
+	for (n = 0; n < num_syms; n++) {
+		len = Boot_Image_Count(&bp);
+		syms[n] = Make_Word(bp, len);
+		bp += len;
+	}
 
-	if (!text || (STR_LEN(text) != NAT_UNCOMPRESSED_SIZE))
-		panic Error_0(RE_BOOT_DATA);
+	bp = Load_Boot_Value(&value, bp, syms);
+	FREE_ARRAY(REBCNT, num_syms, syms);
 
-	boot = Scan_Source(STR_HEAD(text), NAT_UNCOMPRESSED_SIZE);
-	Free_Series(text);
+	if (bp != Boot_Image + BOOT_IMAGE_SIZE || !IS_BLOCK(&value))
+		panic Error_0(RE_BOOT_DATA);
+	boot = VAL_SERIES(&value);
 
 	Set_Root_Series(ROOT_BOOT, boot, "boot block");	// Do not let it get GC'd
 
@@ -1067,6 +1169,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Init_Scanner();
 	Init_Mold(MIN_COMMON/4);
 	Init_Frame();
+	Init_Profile();
 	//Inspect_Series(0);
 
 	SET_TRASH_SAFE(TASK_THROWN_ARG);
@@ -1172,6 +1275,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Init_Scanner();
 	Init_Mold(MIN_COMMON);	// Output buffer
 	Init_Frame();			// Frames
+	Init_Profile();			// Function call profiler
 
 	Lib_Context = Make_Frame(600, TRUE); // !! Have MAKE-BOOT compute # of words
 	Sys_Context = Make_Frame(50, TRUE);
@@ -1339,7 +1443,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	// Run Recycle, but the TRUE flag indicates we want every series
 	// that is managed to be freed.  (Only unmanaged should be left.)
 	//
-	Recycle_Core(TRUE);
+	Recycle_Core(TRUE, FALSE);
 
 	FREE_ARRAY(REBYTE*, RS_MAX, PG_Boot_Strs);
 
@@ -1347,6 +1451,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Shutdown_Event_Scheme();
 	Shutdown_CRC();
 	Shutdown_Mold();
+	Shutdown_Profile();
 	Shutdown_Scanner();
 	Shutdown_Char_Cases();
 	Shutdown_GC();
@@ -1361,20 +1466,27 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	// But for the moment we use the same sweep as the garbage collector,
 	// except sweeping the series it *wasn't* responsible for freeing.
 	{
-		REBSEG *seg = Mem_Pools[SERIES_POOL].segs;
+		REBCNT node_pool;
+		REBSEG *seg;
 		REBCNT n;
 
-		for (; seg != NULL; seg = seg->next) {
-			REBSER *series = cast(REBSER*, seg + 1);
-			for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
-				if (SERIES_FREED(series))
-					continue;
-
-				// Free_Series asserts that a manual series is freed from
-				// the manuals list.  But the GC_Manuals series was never
-				// added to itself (it couldn't be!)
-				if (series != GC_Manuals)
-					Free_Series(series);
+		for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+			for (seg = Mem_Pools[node_pool].segs; seg != NULL; seg = seg->next) {
+				REBSER *series = cast(REBSER*, seg + 1);
+				for (
+					n = Mem_Pools[node_pool].units;
+					n > 0;
+					n--, series = NEXT_SERIES_NODE(series, node_pool)
+				) {
+					if (SERIES_FREED(series))
+						continue;
+
+					// Free_Series asserts that a manual series is freed from
+					// the manuals list.  But the GC_Manuals series was never
+					// added to itself (it couldn't be!)
+					if (series != GC_Manuals)
+						Free_Series(series);
+				}
 			}
 		}
 	}
@@ -478,9 +478,13 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 	// Check for recycle signal:
 	if (GET_FLAG(sigs, SIG_RECYCLE)) {
 		CLR_SIGNAL(SIG_RECYCLE);
-		Recycle();
+		Recycle_Auto();
 	}
 
+	// Free another slice of the series the last recycle found unused:
+	if (GET_FLAG(sigs, SIG_SWEEP))
+		Sweep_Doomed(GC_Sweep_Budget);
+
 #ifdef NOT_USED_INVESTIGATE
 	if (GET_FLAG(sigs, SIG_EVENT_PORT)) {  // !!! Why not used?
 		CLR_SIGNAL(SIG_EVENT_PORT);
@@ -529,6 +533,10 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 
 	REBFLG threw;
 
+	// PROFILE state for this call, only filled in while profiling
+	REBFLG profiled = Profile_Active;
+	struct Reb_Prof_Frame prof;
+
 	// We need to save what the DSF was prior to our execution, and
 	// cannot simply use our frame's prior...because our frame's
 	// prior call frame may be a *pending* frame that we do not want
@@ -546,6 +554,8 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 
 	if (Trace_Flags) Trace_Func(DSF_LABEL(call), func);
 
+	if (profiled) Profile_Enter(&prof, call);
+
 	switch (VAL_TYPE(func)) {
 	case REB_NATIVE:
 		threw = Do_Native_Throws(func);
@@ -569,6 +579,8 @@ void Trace_Arg(REBINT num, const REBVAL *arg, const REBVAL *path)
 		assert(FALSE);
 	}
 
+	if (profiled) Profile_Leave(&prof);
+
 	// Function execution should have written *some* actual output value
 	// over the trash that we put in the return slot before the call.
 	assert(!IS_TRASH(out));
@@ -51,6 +51,10 @@
 
 	s->manuals_tail = SERIES_TAIL(GC_Manuals);
 
+	s->profile_node = Profile_Node;
+	s->profile_child = Profile_Child;
+	s->profile_generation = Profile_Generation;
+
 	s->last_state = Saved_State;
 	Saved_State = s;
 
@@ -114,6 +118,18 @@
 	GC_Series_Guard->tail = state->series_guard_tail;
 	GC_Value_Guard->tail = state->value_guard_tail;
 
+	// Profiled calls that were unwound never got to Profile_Leave.  (If
+	// the profile was reset since, the saved node is gone, and the index
+	// may now belong to an unrelated node of the new tree.)
+	if (state->profile_generation == Profile_Generation) {
+		Profile_Node = state->profile_node;
+		Profile_Child = state->profile_child;
+	}
+	else {
+		Profile_Node = 0;
+		Profile_Child = 0;
+	}
+
 	GC_Disabled = state->gc_disable;
 
 	Saved_State = state->last_state;
@@ -865,11 +865,16 @@
 
 /***********************************************************************
 **
-*/  static void Bind_Values_Inner_Loop(REBINT *binds, REBVAL value[], REBSER *frame, REBCNT mode)
+*/  static void Bind_Values_Inner_Loop(REBINT *binds, REBVAL value[], REBSER *frame, REBCNT mode, REBSER *shared)
 /*
 **		Bind_Values_Core() sets up the binding table and then calls
 **		this recursive routine to do the actual binding.
 **
+**		The keylist the frame had when the bind started is passed as
+**		shared, since other frames may be using it.  It is copied the
+**		first time a word is added, and from then on the frame's own
+**		copy is just extended (rather than copying it for every word).
+**
 ***********************************************************************/
 {
 	REBFLG selfish = !IS_SELFLESS(frame);
@@ -893,7 +898,7 @@
 			else {
 				// Word is not in frame. Add it if option is specified:
 				if ((mode & BIND_ALL) || ((mode & BIND_SET) && (IS_SET_WORD(value)))) {
-					Expand_Frame(frame, 1, 1);
+					Expand_Frame(frame, 1, FRM_KEYLIST(frame) == shared);
 					Append_Frame(frame, value, 0);
 					binds[VAL_WORD_CANON(value)] = VAL_WORD_INDEX(value);
 				}
@@ -901,11 +906,11 @@
 		}
 		else if (ANY_ARRAY(value) && (mode & BIND_DEEP))
 			Bind_Values_Inner_Loop(
-				binds, VAL_BLK_DATA(value), frame, mode
+				binds, VAL_BLK_DATA(value), frame, mode, shared
 			);
 		else if ((IS_FUNCTION(value) || IS_CLOSURE(value)) && (mode & BIND_FUNC))
 			Bind_Values_Inner_Loop(
-				binds, BLK_HEAD(VAL_FUNC_BODY(value)), frame, mode
+				binds, BLK_HEAD(VAL_FUNC_BODY(value)), frame, mode, shared
 			);
 	}
 }
@@ -952,7 +957,7 @@
 			binds[VAL_TYPESET_CANON(key)] = index;
 	}
 
-	Bind_Values_Inner_Loop(binds, &value[0], frame, mode);
+	Bind_Values_Inner_Loop(binds, &value[0], frame, mode, FRM_KEYLIST(frame));
 
 	// Reset binding table:
 	for (key = FRM_KEYS(frame) + 1; NOT_END(key); key++)
@@ -962,6 +967,135 @@
 }
 
 
+/***********************************************************************
+**
+*/  static REBSER *Copy_Rebind_Inner_Loop(REBSER *array, REBCNT index, REBSER *frame, const REBINT *binds, REBSER *paramlist, REBFLG in_place)
+/*
+**		Bind words of the array (and of the arrays inside of it) to
+**		the frame, copying only the arrays that have such words.
+**		Which words, depends on the mode:
+**
+**			binds: those with a slot in the binding table, looking
+**				at inner arrays from their index (as Bind_Values_Deep)
+**			else: those bound relative to the paramlist, looking at
+**				inner arrays from their head (as Bind_Relative bound them)
+**
+**		Unless the array is to be bound in place, it is only copied
+**		(and the copy returned) if a word in it or in an array inside
+**		of it is bound, else NULL.
+**
+***********************************************************************/
+{
+	REBSER *copy = in_place ? array : NULL;
+	REBSER *sub = NULL;
+	REBVAL *value;
+	REBCNT n;
+
+	for (n = index; n < SERIES_TAIL(array); n++) {
+		value = BLK_SKIP(array, n);
+
+		if (ANY_WORD(value)) {
+			if (binds) {
+				if (binds[VAL_WORD_CANON(value)] == 0) continue;
+			}
+			else if (VAL_WORD_FRAME(value) != paramlist)
+				continue;
+		}
+		else if (ANY_ARRAY(value)) {
+			sub = Copy_Rebind_Inner_Loop(
+				VAL_SERIES(value),
+				binds ? VAL_INDEX(value) : 0,
+				frame,
+				binds,
+				paramlist,
+				FALSE
+			);
+			if (!sub) continue;
+		}
+		else
+			continue;
+
+		if (!copy) {
+			copy = Copy_Array_Shallow(array);
+			MANAGE_SERIES(copy);
+		}
+		value = BLK_SKIP(copy, n);
+
+		if (ANY_ARRAY(value))
+			VAL_SERIES(value) = sub;
+		else {
+			VAL_WORD_INDEX(value) = binds
+				? binds[VAL_WORD_CANON(value)]
+				: -VAL_WORD_INDEX(value);
+			VAL_WORD_FRAME(value) = frame;
+		}
+	}
+
+	return copy;
+}
+
+
+/***********************************************************************
+**
+*/  REBSER *Copy_Bind_Array_At_Managed(REBSER *array, REBCNT index, REBSER *frame)
+/*
+**		Copy an array from the index and bind it deeply to a selfless
+**		frame, as Copy_Array_At_Deep_Managed() then Bind_Values_Deep()
+**		would.  But the arrays inside of it are only copied if they
+**		have one of the frame's words in them (or an array that does),
+**		and everything else is shared with the original.
+**
+**		This is for code like loop bodies, which is run often with a
+**		new frame each time but usually only mentions that frame's
+**		words in a few places.
+**
+***********************************************************************/
+{
+	REBVAL *key;
+	REBCNT n;
+	REBSER *copy;
+	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
+
+	assert(IS_SELFLESS(frame));
+
+	CHECK_BIND_TABLE;
+
+	for (n = 1; n < frame->tail; n++) {
+		key = FRM_KEY(frame, n);
+		if (!VAL_GET_OPT(key, EXT_WORD_HIDE))
+			binds[VAL_TYPESET_CANON(key)] = n;
+	}
+
+	copy = Copy_Array_At_Shallow(array, index);
+	MANAGE_SERIES(copy);
+	Copy_Rebind_Inner_Loop(copy, 0, frame, binds, NULL, TRUE);
+
+	for (key = FRM_KEYS(frame) + 1; NOT_END(key); key++)
+		binds[VAL_TYPESET_CANON(key)] = 0;
+
+	CHECK_BIND_TABLE;
+
+	return copy;
+}
+
+
+/***********************************************************************
+**
+*/  REBSER *Copy_Rebind_Relative_Managed(REBSER *body, REBSER *paramlist, REBSER *frame)
+/*
+**		Return the body with its words that are bound relative to the
+**		paramlist (see Bind_Relative) bound to the frame instead.  Only
+**		the arrays that have such words in them (or an array that does)
+**		are copied, and everything else is shared with the body.  If
+**		there are none at all, the body itself is returned.
+**
+***********************************************************************/
+{
+	REBSER *copy = Copy_Rebind_Inner_Loop(body, 0, frame, NULL, paramlist, FALSE);
+	return copy ? copy : body;
+}
+
+
 /***********************************************************************
 **
 */  void Unbind_Values_Core(REBVAL value[], REBSER *frame, REBOOL deep)
@@ -1217,6 +1351,31 @@
 }
 
 
+/***********************************************************************
+**
+*/  struct Reb_Call *Find_Relative_Call(REBSER *paramlist)
+/*
+**      Find the most recent running call of the function whose
+**      paramlist a stack-relative word is bound to, or NULL if no
+**      instance of that function is on the call stack.
+**
+***********************************************************************/
+{
+	struct Reb_Call *call;
+
+	// Get_Var could theoretically be called with no evaluation on
+	// the stack, so check for no DSF first...
+	for (call = DSF; call; call = PRIOR_DSF(call)) {
+		if (call->args_ready && paramlist == VAL_FUNC_PARAMLIST(DSF_FUNC(call))) {
+			assert(!IS_CLOSURE(DSF_FUNC(call)));
+			return call;
+		}
+	}
+
+	return NULL;
+}
+
+
 /***********************************************************************
 **
 */  REBVAL *Get_Var_Core(const REBVAL *word, REBOOL trap, REBOOL writable)
@@ -1271,49 +1430,34 @@
 		// multiple invocations are on the stack, most recent wins)
 
 		if (index < 0) {
-			struct Reb_Call *call = DSF;
-
-			// Get_Var could theoretically be called with no evaluation on
-			// the stack, so check for no DSF first...
-			while (call) {
-				if (
-					call->args_ready
-					&& context == VAL_FUNC_PARAMLIST(DSF_FUNC(call))
-				) {
-					REBVAL *value;
-
-					assert(!IS_CLOSURE(DSF_FUNC(call)));
-
-					assert(
-						SAME_SYM(
-							VAL_WORD_SYM(word),
-							VAL_TYPESET_SYM(
-								VAL_FUNC_PARAM(DSF_FUNC(call), -index)
-							)
-						)
-					);
+			struct Reb_Call *call = Find_Relative_Call(context);
+			REBVAL *value;
 
-					if (
-						writable &&
-						VAL_GET_EXT(
-							VAL_FUNC_PARAM(DSF_FUNC(call), -index),
-							EXT_WORD_LOCK
-						)
-					) {
-						if (trap) raise Error_1(RE_LOCKED_WORD, word);
-						return NULL;
-					}
-
-					value = DSF_ARG(call, -index);
-					assert(!THROWN(value));
-					return value;
-				}
+			if (!call) {
+				if (trap) raise Error_1(RE_NO_RELATIVE, word);
+				return NULL;
+			}
 
-				call = PRIOR_DSF(call);
+			assert(
+				SAME_SYM(
+					VAL_WORD_SYM(word),
+					VAL_TYPESET_SYM(VAL_FUNC_PARAM(DSF_FUNC(call), -index))
+				)
+			);
+
+			if (
+				writable &&
+				VAL_GET_EXT(
+					VAL_FUNC_PARAM(DSF_FUNC(call), -index), EXT_WORD_LOCK
+				)
+			) {
+				if (trap) raise Error_1(RE_LOCKED_WORD, word);
+				return NULL;
 			}
 
-			if (trap) raise Error_1(RE_NO_RELATIVE, word);
-			return NULL;
+			value = DSF_ARG(call, -index);
+			assert(!THROWN(value));
+			return value;
 		}
 
 		// ZERO INDEX: The word is SELF.  Although the information needed
@@ -1364,30 +1508,21 @@
 		}
 
 		if (index < 0) {
-			struct Reb_Call *call = DSF;
-			while (call) {
-				if (
-					call->args_ready
-					&& context == VAL_FUNC_PARAMLIST(DSF_FUNC(call))
-				) {
-					assert(
-						SAME_SYM(
-							VAL_WORD_SYM(word),
-							VAL_TYPESET_SYM(
-								VAL_FUNC_PARAM(DSF_FUNC(call), -index)
-							)
-						)
-					);
-					assert(!IS_CLOSURE(DSF_FUNC(call)));
-					*out = *DSF_ARG(call, -index);
-					assert(!IS_TRASH(out));
-					assert(!THROWN(out));
-					return;
-				}
-				call = PRIOR_DSF(call);
-			}
+			struct Reb_Call *call = Find_Relative_Call(context);
+
+			if (!call) raise Error_1(RE_NO_RELATIVE, word);
+
+			assert(
+				SAME_SYM(
+					VAL_WORD_SYM(word),
+					VAL_TYPESET_SYM(VAL_FUNC_PARAM(DSF_FUNC(call), -index))
+				)
+			);
 
-			raise Error_1(RE_NO_RELATIVE, word);
+			*out = *DSF_ARG(call, -index);
+			assert(!IS_TRASH(out));
+			assert(!THROWN(out));
+			return;
 		}
 
 		// Key difference between Get_Var_Into and Get_Var...fabricating
@@ -1442,11 +1577,8 @@
 	if (index == 0) raise Error_0(RE_SELF_PROTECTED);
 
 	// Find relative value:
-	call = DSF;
-	while (VAL_WORD_FRAME(word) != VAL_FUNC_PARAMLIST(DSF_FUNC(call))) {
-		call = PRIOR_DSF(call);
-		if (!call) raise Error_1(RE_NO_RELATIVE, word);
-	}
+	call = Find_Relative_Call(VAL_WORD_FRAME(word));
+	if (!call) raise Error_1(RE_NO_RELATIVE, word);
 
 	assert(
 		SAME_SYM(
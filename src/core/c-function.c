@@ -694,8 +694,9 @@ REBNATIVE(exit);
 	//
 	// (This is done for the closure body even though each call is associated
 	// with an object frame.  The reason is that this is only the "archetype"
-	// body of the closure...it is copied each time and the real numbers
-	// filled in.  Having the indexes already done speeds the copying.)
+	// body of the closure...the arrays with its words in them are copied
+	// each time and the real numbers filled in.  Having the indexes
+	// already done speeds the copying.)
 
 	Bind_Relative(
 		VAL_FUNC_PARAMLIST(out), VAL_FUNC_PARAMLIST(out), VAL_FUNC_BODY(out)
@@ -1000,8 +1001,10 @@ REBNATIVE(exit);
 **
 */	REBFLG Do_Closure_Throws(const REBVAL *func)
 /*
-**		Do a closure by cloning its body and rebinding it to
-**		a new frame of words/values.
+**		Do a closure by rebinding its body to a new frame of
+**		words/values.  Only the parts of the body that refer to the
+**		closure's words are copied for this; the rest is shared by
+**		all the calls.
 **
 ***********************************************************************/
 {
@@ -1073,12 +1076,15 @@ REBNATIVE(exit);
 	}
 #endif
 
-	// Clone the body of the closure to allow us to rebind words inside
-	// of it so that they point specifically to the instances for this
-	// invocation.  (Costly, but that is the mechanics of words.)
+	// Words point at the instance of the variable they refer to, so the
+	// arrays holding the closure's own words have to be copied to rebind
+	// them to this invocation.  But code in a closure body is mostly
+	// calls to other things, and the blocks that don't mention the
+	// closure's words (nor hold a block that does) need not be copied.
 	//
-	body = Copy_Array_Deep_Managed(VAL_FUNC_BODY(func));
-	Rebind_Block(VAL_FUNC_PARAMLIST(func), frame, BLK_HEAD(body), REBIND_TYPE);
+	body = Copy_Rebind_Relative_Managed(
+		VAL_FUNC_BODY(func), VAL_FUNC_PARAMLIST(func), frame
+	);
 
 	// Protect the body from garbage collection during the course of the
 	// execution.  (We could also protect it by stowing it in the call
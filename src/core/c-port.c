@@ -441,9 +441,9 @@
 ***********************************************************************/
 
 #ifdef HAS_POSIX_SIGNAL
-#define MAX_SCHEMES 12		// max native schemes
+#define MAX_SCHEMES 15		// max native schemes
 #else
-#define MAX_SCHEMES 11		// max native schemes
+#define MAX_SCHEMES 14		// max native schemes
 #endif
 
 typedef struct rebol_scheme_actions {
@@ -575,6 +575,8 @@ SCHEME_ACTIONS *Scheme_Actions;	// Initial Global (not threaded)
 	Init_TCP_Scheme();
 	Init_UDP_Scheme();
 	Init_DNS_Scheme();
+	Init_Compress_Scheme();
+	Init_Checksum_Scheme();
 
 #ifdef TO_WINDOWS
 	Init_Clipboard_Scheme();
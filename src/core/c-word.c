@@ -178,6 +178,15 @@
 }
 
 
+#define WORD_CACHE_SIZE 1024	// must be a power of two
+
+// Cheap slot in the word cache for a spelling.  Hits are checked against
+// the whole spelling, so this only needs to spread out common words.
+#define WORD_CACHE_SLOT(s, n) \
+	(((n) * 61 + (s)[0] * 7 + (s)[(n) - 1] * 3 + (s)[(n) >> 1]) \
+		& (WORD_CACHE_SIZE - 1))
+
+
 /***********************************************************************
 **
 */	REBCNT Make_Word(const REBYTE *str, REBCNT len)
@@ -186,6 +195,11 @@
 **		search for a match, and if not found, add it to the table.
 **		Return the table index for the word (whether found or new).
 **
+**		Loaded code and data use the same few spellings over and over,
+**		so the symbols last made or found are kept in a small cache
+**		by spelling.  A hit there (the exact same bytes, so the exact
+**		same symbol) is returned without hashing or probing.
+**
 ***********************************************************************/
 {
 	REBINT	hash;
@@ -196,6 +210,7 @@
 	REBCNT	*hashes;
 	REBVAL  *words;
 	REBVAL  *w;
+	REBCNT	*cached;
 
 	//REBYTE *sss = Get_Sym_Name(1);	// (Debugging method)
 
@@ -206,6 +221,17 @@
 
 	// !!! ...but should the zero length word be a valid word?
 
+	cached = cast(REBCNT*, SERIES_DATA(PG_Word_Table.cache))
+		+ WORD_CACHE_SLOT(str, len);
+	if (*cached) {
+		// (spellings have no NUL bytes, so strncmp() stops at its end)
+		const char *name = cs_cast(
+			VAL_SYM_NAME(BLK_SKIP(PG_Word_Table.series, *cached))
+		);
+		if (strncmp(name, cs_cast(str), len) == 0 && name[len] == '\0')
+			return *cached;
+	}
+
 	// If hash part of word table is too dense, expand it:
 	if (PG_Word_Table.series->tail > PG_Word_Table.hashes->tail/2)
 		Expand_Word_Table();
@@ -237,7 +263,7 @@
 		while ((n = Compare_UTF8(VAL_SYM_NAME(words+h), str, len)) >= 0) {
 			//if (Match_String("script", str, len))
 			//	Debug_Fmt("---- %s %d %d\n", VAL_SYM_NAME(&words[h]), n, h);
-			if (n == 0) return h; // direct hit
+			if (n == 0) return *cached = h; // direct hit
 			if (VAL_SYM_ALIAS(words+h)) h = VAL_SYM_ALIAS(words+h);
 			else goto make_sym; // Create new alias for word
 		}
@@ -268,7 +294,7 @@ make_sym:
 	Bind_Table->tail++;
 
 	assert(n != SYM_0);
-	return n;
+	return *cached = n;
 }
 
 
@@ -419,6 +445,13 @@ make_sym:
 		LABEL_SERIES(PG_Word_Table.series, "word table"); // words are never GC'd
 		PG_Word_Table.series->tail = 1;  // prevent the zero case
 
+		PG_Word_Table.cache = Make_Series(
+			WORD_CACHE_SIZE + 1, sizeof(REBCNT), MKS_NONE
+		);
+		LABEL_SERIES(PG_Word_Table.cache, "word cache");
+		Clear_Series(PG_Word_Table.cache);
+		PG_Word_Table.cache->tail = WORD_CACHE_SIZE;
+
 		// A normal char array to hold symbol names:
 		PG_Word_Names = Make_Binary(6 * WORD_TABLE_SIZE); // average word size
 		LABEL_SERIES(PG_Word_Names, "word names");
@@ -0,0 +1,369 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  Copyright 2015 Rebol Open Source Contributors
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  d-profile.c
+**  Summary: function call profiler
+**  Section: debug
+**  Author:  Ren/C contributors
+**  Notes:
+**
+**		While PROFILE is on, Dispatch_Call_Throws brackets each function
+**		call with Profile_Enter() and Profile_Leave().  Time is taken
+**		from OS_DELTA_TIME (microseconds).  Individual short calls will
+**		often measure as 0 or 1, but since the clock is not in phase
+**		with the calls the totals come out right over many calls.
+**
+**		Calls are recorded in a calling-context tree: one node per
+**		distinct chain of function labels from the top level, holding
+**		the call count and the inclusive and exclusive time spent there.
+**		Nodes live in the Profile_Nodes series and refer to each other
+**		by index (node 0 is the top level), so they survive expansion.
+**
+**		Per-label totals and flamegraph "collapsed stacks" are both
+**		derived from the tree only when asked for, keeping the cost per
+**		call down to a walk of the (usually short) list of callees seen
+**		from the current node.
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+struct Reb_Prof_Node {
+	REBCNT sym;		// canon symbol of the label the function was called by
+	REBCNT parent;	// node of the caller
+	REBCNT child;	// first node called from this one (0 if none)
+	REBCNT next;	// next node with the same parent (0 if none)
+	REBCNT calls;
+	REBI64 incl;	// microseconds, including callees
+	REBI64 excl;	// microseconds, excluding callees
+};
+
+#define PROF_NODE(n) \
+	(cast(struct Reb_Prof_Node*, SERIES_DATA(Profile_Nodes)) + (n))
+
+// Per-label totals gathered by the report
+struct Reb_Prof_Stat {
+	REBCNT sym;
+	REBCNT calls;
+	REBI64 incl;
+	REBI64 excl;
+};
+
+
+/***********************************************************************
+**
+*/	static void Reset_Profile(void)
+/*
+**		Throw away all nodes except the top level one.
+**
+***********************************************************************/
+{
+	struct Reb_Prof_Node *root;
+
+	Profile_Nodes->tail = 1;
+	root = PROF_NODE(0);
+	CLEAR(root, sizeof(struct Reb_Prof_Node));
+
+	Profile_Node = 0;
+	Profile_Child = 0;
+	Profile_Generation++;
+}
+
+
+/***********************************************************************
+**
+*/	void Profile_Enter(struct Reb_Prof_Frame *prof, struct Reb_Call *call)
+/*
+**		Called by Dispatch_Call_Throws as a function starts running,
+**		when profiling is on.  Finds (or adds) the node for this label
+**		under the current one and makes it current.
+**
+***********************************************************************/
+{
+	REBCNT sym = VAL_WORD_CANON(DSF_LABEL(call));
+	REBCNT parent = Profile_Node;
+	REBCNT n;
+
+	for (n = PROF_NODE(parent)->child; n != 0; n = PROF_NODE(n)->next) {
+		if (PROF_NODE(n)->sym == sym) break;
+	}
+
+	if (n == 0) {
+		struct Reb_Prof_Node *node;
+
+		n = SERIES_TAIL(Profile_Nodes);
+		EXPAND_SERIES_TAIL(Profile_Nodes, 1);
+
+		node = PROF_NODE(n);
+		node->sym = sym;
+		node->parent = parent;
+		node->child = 0;
+		node->next = PROF_NODE(parent)->child;
+		node->calls = 0;
+		node->incl = 0;
+		node->excl = 0;
+
+		PROF_NODE(parent)->child = n;
+	}
+
+	prof->generation = Profile_Generation;
+	prof->node = n;
+	prof->parent = parent;
+	prof->child = Profile_Child;
+
+	Profile_Node = n;
+	Profile_Child = 0;
+
+	prof->start = OS_DELTA_TIME(0, 0);
+}
+
+
+/***********************************************************************
+**
+*/	void Profile_Leave(struct Reb_Prof_Frame *prof)
+/*
+**		Called by Dispatch_Call_Throws when a function that was entered
+**		with Profile_Enter() returns.  Time spent in callees has been
+**		summed in Profile_Child, which is how the exclusive time is found.
+**
+***********************************************************************/
+{
+	REBI64 incl = OS_DELTA_TIME(prof->start, 0);
+	struct Reb_Prof_Node *node;
+
+	// PROFILE ON was run somewhere inside this call and threw away the
+	// node it was recorded against.
+	if (prof->generation != Profile_Generation) return;
+
+	node = PROF_NODE(prof->node);
+	node->calls++;
+	node->incl += incl;
+	node->excl += incl - Profile_Child;
+
+	Profile_Node = prof->parent;
+	Profile_Child = prof->child + incl;
+}
+
+
+/***********************************************************************
+**
+*/	static int Compare_Prof_Stat(void *thunk, const void *v1, const void *v2)
+/*
+**		Order by exclusive time, biggest first.
+**
+***********************************************************************/
+{
+	const struct Reb_Prof_Stat *s1 = cast(const struct Reb_Prof_Stat*, v1);
+	const struct Reb_Prof_Stat *s2 = cast(const struct Reb_Prof_Stat*, v2);
+
+	if (s1->excl != s2->excl) return s1->excl < s2->excl ? 1 : -1;
+	if (s1->incl != s2->incl) return s1->incl < s2->incl ? 1 : -1;
+	return s1->sym < s2->sym ? -1 : (s1->sym > s2->sym ? 1 : 0);
+}
+
+
+/***********************************************************************
+**
+*/	static void Init_Prof_Time(REBVAL *out, REBI64 usecs)
+/*
+***********************************************************************/
+{
+	VAL_SET(out, REB_TIME);
+	VAL_TIME(out) = usecs * 1000;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Profile_Report(void)
+/*
+**		Make a block of [label calls inclusive exclusive] blocks, one
+**		per function label, ordered by exclusive time.
+**
+**		A label reached again through recursion adds its calls and
+**		exclusive time, but its inclusive time is only counted at the
+**		outermost level (or it would be counted many times over).
+**
+***********************************************************************/
+{
+	REBCNT num_syms = SERIES_TAIL(PG_Word_Table.series);
+	REBSER *stats = Make_Series(
+		num_syms, sizeof(struct Reb_Prof_Stat), MKS_NONE
+	);
+	struct Reb_Prof_Stat *stat;
+	REBCNT count;
+	REBSER *block;
+	REBCNT n;
+
+	CLEAR(SERIES_DATA(stats), num_syms * sizeof(struct Reb_Prof_Stat));
+
+	for (n = 1; n < SERIES_TAIL(Profile_Nodes); n++) {
+		struct Reb_Prof_Node *node = PROF_NODE(n);
+		REBCNT up;
+
+		assert(node->sym < num_syms);
+		stat = cast(struct Reb_Prof_Stat*, SERIES_DATA(stats)) + node->sym;
+
+		stat->sym = node->sym;
+		stat->calls += node->calls;
+		stat->excl += node->excl;
+
+		for (up = node->parent; up != 0; up = PROF_NODE(up)->parent)
+			if (PROF_NODE(up)->sym == node->sym) break;
+		if (up == 0)
+			stat->incl += node->incl;
+	}
+
+	// Squeeze the labels that were called to the front, then sort them
+	stat = cast(struct Reb_Prof_Stat*, SERIES_DATA(stats));
+	for (n = 0, count = 0; n < num_syms; n++) {
+		if (stat[n].calls != 0) stat[count++] = stat[n];
+	}
+	reb_qsort_r(
+		stat, count, sizeof(struct Reb_Prof_Stat), NULL, Compare_Prof_Stat
+	);
+
+	block = Make_Array(count);
+	for (n = 0; n < count; n++) {
+		REBSER *row = Make_Array(4);
+		REBVAL *calls;
+
+		Val_Init_Word_Unbound(Alloc_Tail_Array(row), REB_WORD, stat[n].sym);
+		calls = Alloc_Tail_Array(row);
+		SET_INTEGER(calls, stat[n].calls);
+		Init_Prof_Time(Alloc_Tail_Array(row), stat[n].incl);
+		Init_Prof_Time(Alloc_Tail_Array(row), stat[n].excl);
+
+		Val_Init_Block(Alloc_Tail_Array(block), row);
+	}
+
+	Free_Series(stats);
+	return block;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Profile_Stacks(void)
+/*
+**		Make a string of "collapsed stacks", one line per calling
+**		context with its exclusive time in microseconds:
+**
+**			main;load;transcode 1234
+**
+**		This is the input format of flamegraph.pl and most tools that
+**		draw flame graphs.
+**
+***********************************************************************/
+{
+	REBSER *str = Make_Binary(SERIES_TAIL(Profile_Nodes) * 16);
+	REBSER *path = Make_Series(16, sizeof(REBCNT), MKS_NONE);
+	REBYTE buf[32];
+	REBCNT n;
+
+	for (n = 1; n < SERIES_TAIL(Profile_Nodes); n++) {
+		REBCNT up;
+		REBCNT i;
+
+		if (PROF_NODE(n)->excl <= 0) continue;
+
+		// Gather the labels from here to the top, then emit them reversed
+		RESET_TAIL(path);
+		for (up = n; up != 0; up = PROF_NODE(up)->parent) {
+			EXPAND_SERIES_TAIL(path, 1);
+			cast(REBCNT*, SERIES_DATA(path))[path->tail - 1] = up;
+		}
+
+		for (i = path->tail; i > 0; i--) {
+			up = cast(REBCNT*, SERIES_DATA(path))[i - 1];
+			str = Append_UTF8(str, Get_Sym_Name(PROF_NODE(up)->sym), -1);
+			if (i > 1) Append_Codepoint_Raw(str, ';');
+		}
+
+		Append_Codepoint_Raw(str, ' ');
+		Append_Unencoded_Len(
+			str, s_cast(buf), Emit_Integer(buf, PROF_NODE(n)->excl)
+		);
+		Append_Codepoint_Raw(str, '\n');
+	}
+
+	Free_Series(path);
+	return str;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(profile)
+/*
+***********************************************************************/
+{
+	REBVAL *mode = D_ARG(1);
+
+	Check_Security(SYM_DEBUG, POL_READ, 0);
+
+	// Results are taken before the mode applies, so that `profile/report
+	// off` stops and reports and `profile/report on` reports and restarts.
+	if (D_REF(2)) // /report
+		Val_Init_Block(D_OUT, Profile_Report());
+	else if (D_REF(3)) // /stacks
+		Val_Init_String(D_OUT, Profile_Stacks());
+	else
+		SET_UNSET(D_OUT);
+
+	if (VAL_LOGIC(mode)) {
+		Reset_Profile();
+		Profile_Active = TRUE;
+	}
+	else
+		Profile_Active = FALSE;
+
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	void Init_Profile(void)
+/*
+***********************************************************************/
+{
+	Profile_Active = FALSE;
+	Profile_Generation = 0;
+
+	Profile_Nodes = Make_Series(
+		100, sizeof(struct Reb_Prof_Node), MKS_NONE
+	);
+	LABEL_SERIES(Profile_Nodes, "profile nodes");
+
+	Reset_Profile();
+}
+
+
+/***********************************************************************
+**
+*/	void Shutdown_Profile(void)
+/*
+***********************************************************************/
+{
+	Free_Series(Profile_Nodes);
+}
@@ -33,6 +33,14 @@
 
 #include "sys-core.h"
 
+// The scanner's inner loops can test 16 bytes at a time where SSE2 is
+// known to be present (all x86-64 targets).  Elsewhere the same helpers
+// fall back to testing a byte at a time.
+#if defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define SCAN_SSE2
+#endif
+
 // In UTF8 C0, C1, F5, and FF are invalid.
 #ifdef USE_UNICODE
 #define LEX_UTFE LEX_DEFAULT
@@ -309,12 +317,173 @@
 **
 ***********************************************************************/
 {
-	while (cp != ep && *cp != b) cp++;
-	if (*cp == b) return cp;
+	const REBYTE *bp = cast(const REBYTE*, memchr(cp, b, ep - cp));
+
+	if (bp) return bp;
+	if (*ep == b) return ep;
 	return NULL;
 }
 
 
+#ifdef SCAN_SSE2
+
+/***********************************************************************
+**
+*/  static REBCNT Lowest_Bit(REBCNT mask)
+/*
+**		Index of the lowest set bit of a nonzero mask, which is the
+**		position of the first byte matched in a 16 byte block.
+**
+***********************************************************************/
+{
+#ifdef __GNUC__
+	return __builtin_ctz(mask);
+#else
+	REBCNT n = 0;
+	while (!(mask & 1)) {
+		mask >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+
+/***********************************************************************
+**
+*/  static REBCNT Space_Mask_16(const REBYTE *cp)
+/*
+**		Bit mask of which of the 16 bytes at cp are a blank or control
+**		character other than NUL, CR or LF.  (The other bytes that the
+**		Lex_Map treats as spaces, such as DEL, are rare enough to be
+**		left to the byte at a time check.)
+**
+***********************************************************************/
+{
+	__m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+	__m128i x = _mm_sub_epi8(v, _mm_set1_epi8(1)); // NUL wraps to 0xFF
+	__m128i m = _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(0x1F)), x);
+
+	m = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(CR)), m);
+	m = _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(LF)), m);
+	return _mm_movemask_epi8(m);
+}
+
+
+/***********************************************************************
+**
+*/  static REBCNT Line_End_Mask_16(const REBYTE *cp)
+/*
+**		Bit mask of which of the 16 bytes at cp are NUL, CR or LF.
+**
+***********************************************************************/
+{
+	__m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+	__m128i m = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(CR)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(LF)));
+	return _mm_movemask_epi8(m);
+}
+
+
+/***********************************************************************
+**
+*/  static REBCNT Quote_Stop_Mask_16(const REBYTE *cp, REBYTE term)
+/*
+**		Bit mask of which of the 16 bytes at cp need Scan_Quote() to
+**		look at them: the terminator, escapes, braces, line breaks,
+**		NUL and the bytes of UTF-8 sequences.
+**
+***********************************************************************/
+{
+	__m128i v = _mm_loadu_si128(cast(const __m128i*, cp));
+	__m128i m = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(CR)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(LF)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('^')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('{')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('}')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(term)));
+	return _mm_movemask_epi8(m) | _mm_movemask_epi8(v); // high bit set
+}
+
+#endif
+
+
+/***********************************************************************
+**
+*/  static const REBYTE *Skip_Lex_Space(const REBYTE *cp, const REBYTE *limit)
+/*
+**		Skip past whitespace (bytes that are IS_LEX_SPACE).  No byte at
+**		or after the limit is tested until the byte at a time loop,
+**		which stops at the NUL terminator there.
+**
+***********************************************************************/
+{
+#ifdef SCAN_SSE2
+	while (cp + 16 <= limit) {
+		REBCNT mask = ~Space_Mask_16(cp) & 0xFFFF;
+		if (mask) {
+			cp += Lowest_Bit(mask);
+			break;
+		}
+		cp += 16;
+	}
+#endif
+	while (IS_LEX_SPACE(*cp)) cp++;
+	return cp;
+}
+
+
+/***********************************************************************
+**
+*/  static const REBYTE *Skip_To_Line_End(const REBYTE *cp, const REBYTE *limit)
+/*
+**		Skip to the first CR, LF or NUL (as for the rest of a comment).
+**
+***********************************************************************/
+{
+#ifdef SCAN_SSE2
+	while (cp + 16 <= limit) {
+		REBCNT mask = Line_End_Mask_16(cp);
+		if (mask) return cp + Lowest_Bit(mask);
+		cp += 16;
+	}
+#endif
+	while (!ANY_CR_LF_END(*cp)) cp++;
+	return cp;
+}
+
+
+/***********************************************************************
+**
+*/  static REBCNT Plain_Quote_Len(const REBYTE *cp, const REBYTE *limit, REBYTE term)
+/*
+**		Count the bytes from cp that Scan_Quote() can copy across as
+**		they are: ASCII other than the terminator, escapes, braces and
+**		line breaks.
+**
+***********************************************************************/
+{
+	const REBYTE *bp = cp;
+
+#ifdef SCAN_SSE2
+	while (bp + 16 <= limit) {
+		REBCNT mask = Quote_Stop_Mask_16(bp, term);
+		if (mask) return (bp - cp) + Lowest_Bit(mask);
+		bp += 16;
+	}
+#endif
+	while (
+		!ANY_CR_LF_END(*bp) && *bp < 0x80 && *bp != term
+		&& *bp != '^' && *bp != '{' && *bp != '}'
+	) bp++;
+	return bp - cp;
+}
+
+
 /***********************************************************************
 **
 */  static const REBYTE *Scan_UTF8_Char_Escapable(REBUNI *out, const REBYTE *bp)
@@ -432,11 +601,27 @@
 	REBUNI term;
 	REBUNI chr;
 	REBCNT lines = 0;
+	const REBYTE *limit = scan_state ? scan_state->limit : src;
+	REBCNT len;
 
 	term = (*src++ == '{') ? '}' : '"';	// pick termination
 
 	while (*src != term || nest > 0) {
 
+		// Copy plain runs across in one go, with no need for the switch
+		len = Plain_Quote_Len(src, limit, cast(REBYTE, term));
+		if (len > 0) {
+			REBUNI *up;
+
+			if (SERIES_LEN(buf) + len >= SERIES_REST(buf)) // include term.
+				Extend_Series(buf, len);
+
+			up = UNI_SKIP(buf, buf->tail);
+			buf->tail += len;
+			while (len-- > 0) *up++ = *src++;
+			continue;
+		}
+
 		chr = *src;
 
 		switch (chr) {
@@ -680,7 +865,7 @@
 	REBCNT flags = 0;
 
 	// Skip whitespace (if any) and update the scan_state
-	while (IS_LEX_SPACE(*cp)) cp++;
+	cp = Skip_Lex_Space(cp, scan_state->limit);
 	scan_state->begin = cp;
 
 	while (TRUE) {
@@ -832,7 +1017,7 @@
 			DEAD_END;
 
 		case LEX_DELIMIT_SEMICOLON:     /* ; begin comment */
-			while (!ANY_CR_LF_END(*cp)) cp++;
+			cp = Skip_To_Line_End(cp, scan_state->limit);
 			if (!*cp) cp--;             /* avoid passing EOF  */
 			if (*cp == LF) goto line_feed;
 			/* fall thru  */
@@ -1286,7 +1471,7 @@ scanword:
 	REBCNT count = scan_state->line_count;
 
 	while (TRUE) {
-		while (IS_LEX_SPACE(*cp)) cp++; /* skip white space */
+		cp = Skip_Lex_Space(cp, scan_state->limit);
 		switch (*cp) {
 		case '[':
 			if (rp) {
@@ -1313,7 +1498,7 @@ scanword:
 		default:	/* everything else... */
 			if (!ANY_CR_LF_END(*cp)) rp = bp = 0;
 		skipline:
-			while (!ANY_CR_LF_END(*cp)) cp++;
+			cp = Skip_To_Line_End(cp, scan_state->limit);
 			if (*cp == CR && cp[1] == LF) cp++;
 			if (*cp) cp++;
 			count++;
@@ -1350,11 +1535,14 @@ static REBSER *Scan_Full_Block(SCAN_STATE *scan_state, REBYTE mode_char);
 	const REBYTE *start_line = scan_state->head_line;
 	// just_once for load/next see Load_Script for more info.
 	REBOOL just_once = GET_FLAG(scan_state->opts, SCAN_NEXT);
+	REBOOL keep = GET_FLAG(scan_state->opts, SCAN_KEEP);
 
 	if (C_STACK_OVERFLOWING(&token)) Trap_Stack_Overflow();
 
 	if (just_once)
 		CLR_FLAG(scan_state->opts, SCAN_NEXT); // no deeper
+	if (keep)
+		CLR_FLAG(scan_state->opts, SCAN_KEEP); // nested blocks are made
 
 	while (
 #ifdef COMP_LINES
@@ -1722,6 +1910,9 @@ static REBSER *Scan_Full_Block(SCAN_STATE *scan_state, REBYTE mode_char);
 exit_block:
 	if (line && value) VAL_SET_OPT(value, OPT_VALUE_LINE);
 
+	// The caller takes the values from the emit buffer itself:
+	if (keep) return NULL;
+
 #ifdef TEST_SCAN
 	Print((REBYTE*)"block of %d values ", emitbuf->tail - begin);
 #endif
@@ -1773,6 +1964,33 @@ exit_block:
 }
 
 
+/***********************************************************************
+**
+*/	REBFLG Scan_Value(REBVAL *out, const REBYTE *src, REBCNT len)
+/*
+**		Scan source that holds a single value into out, without
+**		making a block to hold it.  Returns FALSE (and out is not
+**		set) if there was not exactly one value.
+**
+***********************************************************************/
+{
+	SCAN_STATE scan_state;
+	REBSER *emitbuf = BUF_EMIT;
+	REBCNT begin = emitbuf->tail;
+	REBFLG single;
+
+	Init_Scan_State(&scan_state, src, len);
+	SET_FLAG(scan_state.opts, SCAN_KEEP);
+	Scan_Block(&scan_state, 0);
+
+	single = (emitbuf->tail == begin + 1);
+	if (single) *out = *BLK_SKIP(emitbuf, begin);
+	emitbuf->tail = begin;
+
+	return single;
+}
+
+
 /***********************************************************************
 **
 */	REBINT Scan_Header(const REBYTE *src, REBCNT len)
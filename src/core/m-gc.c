@@ -65,6 +65,42 @@
 **
 **		SWEEP - Free all collectible values that were not marked.
 **
+**	  Regarding the two generations:
+**
+**		A series is "young" from when it is handed to the GC by
+**		Manage_Series() until it survives its first recycle, at which
+**		point it is "tenured".  The young ones are kept in GC_Nursery,
+**		and the tenured ones in GC_Tenured.
+**
+**		A minor recycle presets the mark on every tenured series, so
+**		the marking from the root set stops as soon as it reaches the
+**		old data.  Only the series in the nursery are swept.
+**
+**		There is no write barrier on array stores (values are written
+**		directly into array memory all over the code), so it is not
+**		known which tenured arrays picked up references to young
+**		series.  Hence every tenured array is treated as part of the
+**		remembered set, and its values are scanned shallowly.  This is
+**		conservative: a tenured array that became garbage keeps what
+**		it references alive until the next full recycle.
+**
+**		A full recycle marks and sweeps everything as before.  It is
+**		done when asked for explicitly (RECYCLE), and after every
+**		MAX_MINOR_RECYCLES minor ones.
+**
+**	  Regarding sweeping in slices:
+**
+**		If GC_Sweep_Budget is set (RECYCLE/BUDGET), the sweep does not
+**		free the unmarked series on the spot.  They are moved into the
+**		GC_Doomed list, and SIG_SWEEP is raised so that Do_Signals()
+**		frees up to the budget of them between each evaluation.  Since
+**		they are unreachable nothing can see them in the meantime, and
+**		any left over are freed before the next recycle begins.
+**
+**		The marking itself is not sliced: letting the evaluator run
+**		between mark slices would need a barrier on every store of a
+**		value into an array, which this code does not have.
+**
 **	  GC protection methods:
 **
 **		KEEP flag - protects an individual series from GC, but
@@ -804,6 +840,112 @@ static void Propagate_All_GC_Marks(void);
 }
 
 
+/***********************************************************************
+**
+*/	static void Tenure_Series(REBSER *series)
+/*
+**		Add a managed series which survived a recycle to the list of
+**		old series.  (Its mark must already have been cleared.)
+**
+***********************************************************************/
+{
+	if (SERIES_FULL(GC_Tenured)) Extend_Series(GC_Tenured, 8);
+	cast(REBSER **, GC_Tenured->data)[GC_Tenured->tail++] = series;
+}
+
+
+/***********************************************************************
+**
+*/	static void Doom_Series(REBSER *series, REBOOL shutdown)
+/*
+**		Free a series the sweep found unmarked--or if sweeping is
+**		being done in slices, put it on the list to be freed later.
+**
+***********************************************************************/
+{
+	if (GC_Sweep_Budget == 0 || shutdown) {
+		GC_Kill_Series(series);
+		return;
+	}
+
+	if (SERIES_FULL(GC_Doomed)) Extend_Series(GC_Doomed, 8);
+	cast(REBSER **, GC_Doomed->data)[GC_Doomed->tail++] = series;
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Sweep_Doomed(REBCNT limit)
+/*
+**		Free up to limit of the series that the last recycle found
+**		unreachable (or all of them, if limit is 0).  Returns the
+**		number freed.
+**
+***********************************************************************/
+{
+	REBCNT count = 0;
+
+	while (SERIES_TAIL(GC_Doomed) > 0 && (limit == 0 || count < limit)) {
+		GC_Kill_Series(
+			cast(REBSER **, GC_Doomed->data)[--GC_Doomed->tail]
+		);
+		count++;
+	}
+
+	if (SERIES_TAIL(GC_Doomed) == 0) CLR_SIGNAL(SIG_SWEEP);
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Mark_Tenured(REBOOL set)
+/*
+**		Set (or clear) the mark on every tenured series.  A minor
+**		recycle sets them before marking, so that the old series are
+**		seen as already live, and clears them again after sweeping.
+**
+***********************************************************************/
+{
+	REBSER **sp = cast(REBSER**, GC_Tenured->data);
+	REBCNT n;
+
+	if (set) {
+		for (n = SERIES_TAIL(GC_Tenured); n > 0; n--, sp++)
+			SERIES_SET_FLAG(*sp, SER_MARK);
+	}
+	else {
+		for (n = SERIES_TAIL(GC_Tenured); n > 0; n--, sp++)
+			SERIES_CLR_FLAG(*sp, SER_MARK);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Mark_Remembered_Set(void)
+/*
+**		Mark what the values of the tenured arrays refer to.  Without
+**		a write barrier any old array may have had a reference to a
+**		young series stored into it since the last recycle, so all of
+**		them have to be scanned.  The scan is shallow: the tenured
+**		arrays they point to are already marked, so are not queued.
+**
+***********************************************************************/
+{
+	REBSER **sp = cast(REBSER**, GC_Tenured->data);
+	REBCNT n;
+
+	for (n = SERIES_TAIL(GC_Tenured); n > 0; n--, sp++) {
+		if (Is_Array_Series(*sp)) {
+			Mark_Array_Deep_Core(*sp);
+			Propagate_All_GC_Marks();
+		}
+	}
+}
+
+
 /***********************************************************************
 **
 */	ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Sweep_Series(REBOOL shutdown)
@@ -830,27 +972,36 @@ static void Propagate_All_GC_Marks(void);
 {
 	REBSEG *seg;
 	REBCNT count = 0;
+	REBCNT node_pool;
+
+	for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+		for (seg = Mem_Pools[node_pool].segs; seg; seg = seg->next) {
+			REBSER *series = cast(REBSER *, seg + 1);
+			REBCNT n;
+			for (
+				n = Mem_Pools[node_pool].units;
+				n > 0;
+				n--, series = NEXT_SERIES_NODE(series, node_pool)
+			) {
+				// See notes on Make_Node() about how the first allocation of a
+				// unit zero-fills *most* of it.  But after that it's up to the
+				// caller of Free_Node() to zero out whatever bits it uses to
+				// indicate "freeness".  We check the zeroness of the `wide`.
+				if (SERIES_FREED(series))
+					continue;
 
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		REBSER *series = cast(REBSER *, seg + 1);
-		REBCNT n;
-		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
-			// See notes on Make_Node() about how the first allocation of a
-			// unit zero-fills *most* of it.  But after that it's up to the
-			// caller of Free_Node() to zero out whatever bits it uses to
-			// indicate "freeness".  We check the zeroness of the `wide`.
-			if (SERIES_FREED(series))
-				continue;
-
-			if (SERIES_GET_FLAG(series, SER_MANAGED)) {
-				if (shutdown || !SERIES_GET_FLAG(series, SER_MARK)) {
-					GC_Kill_Series(series);
-					count++;
-				} else
-					SERIES_CLR_FLAG(series, SER_MARK);
+				if (SERIES_GET_FLAG(series, SER_MANAGED)) {
+					if (shutdown || !SERIES_GET_FLAG(series, SER_MARK)) {
+						Doom_Series(series, shutdown);
+						count++;
+					} else {
+						SERIES_CLR_FLAG(series, SER_MARK);
+						Tenure_Series(series);
+					}
+				}
+				else
+					assert(!SERIES_GET_FLAG(series, SER_MARK));
 			}
-			else
-				assert(!SERIES_GET_FLAG(series, SER_MARK));
 		}
 	}
 
@@ -858,6 +1009,38 @@ static void Propagate_All_GC_Marks(void);
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Sweep_Nursery(void)
+/*
+**		Free the young series that were not marked, and tenure the
+**		ones that were.  Used by a minor recycle instead of walking
+**		the whole SERIES_POOL with Sweep_Series().
+**
+***********************************************************************/
+{
+	REBSER **sp = cast(REBSER**, GC_Nursery->data);
+	REBCNT count = 0;
+	REBCNT n;
+
+	for (n = SERIES_TAIL(GC_Nursery); n > 0; n--, sp++) {
+		assert(SERIES_GET_FLAG(*sp, SER_MANAGED));
+		if (SERIES_GET_FLAG(*sp, SER_MARK)) {
+			SERIES_CLR_FLAG(*sp, SER_MARK);
+			Tenure_Series(*sp);
+		}
+		else {
+			Doom_Series(*sp, FALSE);
+			count++;
+		}
+	}
+
+	SERIES_TAIL(GC_Nursery) = 0;
+
+	return count;
+}
+
+
 /***********************************************************************
 **
 */	ATTRIBUTE_NO_SANITIZE_ADDRESS static REBCNT Sweep_Gobs(void)
@@ -997,14 +1180,17 @@ static void Propagate_All_GC_Marks(void);
 
 /***********************************************************************
 **
-*/	REBCNT Recycle_Core(REBOOL shutdown)
+*/	REBCNT Recycle_Core(REBOOL shutdown, REBOOL minor)
 /*
-**		Recycle memory no longer needed.
+**		Recycle memory no longer needed.  If minor is TRUE, then
+**		only the series managed since the last recycle are freed
+**		(see notes at top of file).
 **
 ***********************************************************************/
 {
 	REBINT n;
 	REBCNT count;
+	REBI64 base;
 
 	//Debug_Num("GC", GC_Disabled);
 
@@ -1021,8 +1207,18 @@ static void Propagate_All_GC_Marks(void);
 
 	GC_Disabled = 1;
 
+	base = OS_DELTA_TIME(0, 0);
+
+	// Finish freeing what the last recycle left over (see SIG_SWEEP).
+	// A series still waiting in that list would look unmarked but alive
+	// to the sweep below.
+	Sweep_Doomed(0);
+
+	if (shutdown) minor = FALSE;
+
 	PG_Reb_Stats->Recycle_Counter++;
-	PG_Reb_Stats->Recycle_Series = Mem_Pools[SERIES_POOL].free;
+	PG_Reb_Stats->Recycle_Series =
+		Mem_Pools[SERIES_POOL].free + Mem_Pools[EMBED_POOL].free;
 
 	PG_Reb_Stats->Mark_Count = 0;
 
@@ -1041,6 +1237,9 @@ static void Propagate_All_GC_Marks(void);
 		REBSER **sp;
 		REBVAL **vp;
 
+		// Old series are taken as live, and are not traced into:
+		if (minor) Mark_Tenured(TRUE);
+
 		// Mark series stack (temp-saved series):
 		sp = cast(REBSER**, GC_Series_Guard->data);
 		for (n = SERIES_TAIL(GC_Series_Guard); n > 0; n--, sp++) {
@@ -1081,6 +1280,9 @@ static void Propagate_All_GC_Marks(void);
 
 		// Mark function call frames:
 		Mark_Call_Frames_Deep();
+
+		// Mark young series referenced from old arrays:
+		if (minor) Mark_Remembered_Set();
 	}
 
 	// SWEEPING PHASE
@@ -1089,17 +1291,40 @@ static void Propagate_All_GC_Marks(void);
 	// with pointers, which can't be simply discarded by Sweep_Series
 	count = Sweep_Routines();
 
-	count += Sweep_Series(shutdown);
+	if (minor) {
+		Mark_Tenured(FALSE);
+		count += Sweep_Nursery(); // tenures the survivors
+	}
+	else {
+		// Every surviving series is tenured by the full sweep
+		SERIES_TAIL(GC_Nursery) = 0;
+		SERIES_TAIL(GC_Tenured) = 0;
+		count += Sweep_Series(shutdown);
+	}
 	count += Sweep_Gobs();
 	count += Sweep_Libs();
 
+	if (SERIES_TAIL(GC_Doomed) > 0) SET_SIGNAL(SIG_SWEEP);
+
 	CHECK_MEMORY(4);
 
 	// Compute new stats:
-	PG_Reb_Stats->Recycle_Series = Mem_Pools[SERIES_POOL].free - PG_Reb_Stats->Recycle_Series;
+	PG_Reb_Stats->Recycle_Series =
+		Mem_Pools[SERIES_POOL].free + Mem_Pools[EMBED_POOL].free
+		- PG_Reb_Stats->Recycle_Series;
 	PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
 	PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
 
+	if (minor) {
+		GC_Minor_Count++;
+		PG_Reb_Stats->Recycle_Minor++;
+		PG_Reb_Stats->Recycle_Minor_Time += OS_DELTA_TIME(base, 0);
+	}
+	else {
+		GC_Minor_Count = 0;
+		PG_Reb_Stats->Recycle_Major_Time += OS_DELTA_TIME(base, 0);
+	}
+
 	if (GC_Ballast <= VAL_INT32(TASK_BALLAST) / 2
 		&& VAL_INT64(TASK_BALLAST) < MAX_I32) {
 		//increasing ballast by half
@@ -1135,7 +1360,21 @@ static void Propagate_All_GC_Marks(void);
 ***********************************************************************/
 {
 	// Default to not passing the `shutdown` flag.
-	return Recycle_Core(FALSE);
+	return Recycle_Core(FALSE, FALSE);
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Recycle_Auto(void)
+/*
+**		Recycle memory when the GC ballast has run out.  This is a
+**		minor recycle, unless MAX_MINOR_RECYCLES of those have been
+**		done since the last full one.
+**
+***********************************************************************/
+{
+	return Recycle_Core(FALSE, GC_Minor_Count < MAX_MINOR_RECYCLES);
 }
 
 
@@ -1213,6 +1452,18 @@ static void Propagate_All_GC_Marks(void);
 	GC_Mark_Stack = Make_Series(100, sizeof(REBSER *), MKS_NONE);
 	TERM_SEQUENCE(GC_Mark_Stack);
 	LABEL_SERIES(GC_Mark_Stack, "gc mark stack");
+
+	// The two generations of managed series. Holds series pointers.
+	GC_Nursery = Make_Series(100, sizeof(REBSER *), MKS_NONE);
+	LABEL_SERIES(GC_Nursery, "gc nursery");
+	GC_Tenured = Make_Series(100, sizeof(REBSER *), MKS_NONE);
+	LABEL_SERIES(GC_Tenured, "gc tenured");
+	GC_Minor_Count = 0;
+
+	// Unreachable series to be freed in slices. Holds series pointers.
+	GC_Doomed = Make_Series(100, sizeof(REBSER *), MKS_NONE);
+	LABEL_SERIES(GC_Doomed, "gc doomed");
+	GC_Sweep_Budget = 0;
 }
 
 
@@ -1225,4 +1476,7 @@ static void Propagate_All_GC_Marks(void);
 	Free_Series(GC_Series_Guard);
 	Free_Series(GC_Value_Guard);
 	Free_Series(GC_Mark_Stack);
+	Free_Series(GC_Nursery);
+	Free_Series(GC_Tenured);
+	Free_Series(GC_Doomed);
 }
@@ -239,6 +239,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	DEF_POOL(MEM_BIG_SIZE*4, 4),	// 4K
 
 	DEF_POOL(sizeof(REBSER), 4096),	// Series headers
+	DEF_POOL(sizeof(REBSER) + SERIES_EMBED_SIZE, 2048), // ...with small data
 	DEF_POOL(sizeof(REBGOB), 128),	// Gobs
 	DEF_POOL(sizeof(REBLHL), 32), // external libraries
 	DEF_POOL(sizeof(REBRIN), 128), // external routines
@@ -300,6 +301,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	// organized to have some of the logic not in the pools file
 
 	PG_Reb_Stats = ALLOC(REB_STATS);
+	CLEAR(PG_Reb_Stats, sizeof(REB_STATS));
 
 	// Manually allocated series that GC is not responsible for (unless a
 	// trap occurs). Holds series pointers.
@@ -581,6 +583,12 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **		or an operation like expansion.  Currently not exported
 **		from this file.
 **
+**		With MKS_EMBED (passed only by Make_Series, for a header from
+**		the EMBED_POOL), data that fits in SERIES_EMBED_SIZE goes in
+**		the node right after the header.  Other callers are replacing
+**		data that may be in the node, so they always get a separate
+**		allocation.
+**
 ***********************************************************************/
 {
 	REBCNT size; // size of allocation (possibly bigger than we need)
@@ -591,7 +599,14 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	// and nulled it to indicate taking responsibility for freeing it.
 	assert(!series->data);
 
-	if (pool_num < SYSTEM_POOL) {
+	if ((flags & MKS_EMBED) && length * wide <= SERIES_EMBED_SIZE) {
+		// ...small enough to keep in the series node itself
+		assert(series->node_pool == EMBED_POOL);
+		series->data = SERIES_EMBED_DATA(series);
+		size = SERIES_EMBED_SIZE;
+		SERIES_CLR_FLAG(series, SER_POWER_OF_2);
+	}
+	else if (pool_num < SYSTEM_POOL) {
 		// ...there is a pool designated for allocations of this size range
 		series->data = cast(REBYTE*, Make_Node(pool_num));
 		if (!series->data)
@@ -679,23 +694,30 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 /*
 ***********************************************************************/
 {
+	REBCNT pool_num;
 	REBSEG *seg;
 
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		REBSER *series = cast(REBSER *, seg + 1);
-		REBCNT n;
-		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
-			if (SERIES_FREED(series))
-				continue;
-
-			assert(
-				(pointer < cast(void *, series->data)) ||
-				(pointer >= cast(void *, (
-					series->data
-					- (SERIES_WIDE(series) * SERIES_BIAS(series))
-					+ Series_Allocated_Size(series)
-				)))
-			);
+	for (pool_num = SERIES_POOL; pool_num <= EMBED_POOL; pool_num++) {
+		for (seg = Mem_Pools[pool_num].segs; seg; seg = seg->next) {
+			REBSER *series = cast(REBSER *, seg + 1);
+			REBCNT n;
+			for (
+				n = Mem_Pools[pool_num].units;
+				n > 0;
+				n--, series = NEXT_SERIES_NODE(series, pool_num)
+			) {
+				if (SERIES_FREED(series))
+					continue;
+
+				assert(
+					(pointer < cast(void *, series->data)) ||
+					(pointer >= cast(void *, (
+						series->data
+						- (SERIES_WIDE(series) * SERIES_BIAS(series))
+						+ Series_Allocated_Size(series)
+					)))
+				);
+			}
 		}
 	}
 }
@@ -730,6 +752,8 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	REBCNT total = SERIES_TOTAL(series);
 	REBCNT pool_num = FIND_POOL(total);
 
+	if (SERIES_EMBEDDED(series)) return SERIES_EMBED_SIZE;
+
 	if (pool_num < SERIES_POOL) {
 		assert(!SERIES_GET_FLAG(series, SER_POWER_OF_2));
 		assert(Mem_Pools[pool_num].wide >= total);
@@ -752,6 +776,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 */	REBSER *Make_Series(REBCNT length, REBYTE wide, REBCNT flags)
 /*
 **		Make a series of a given length and width (unit size).
+**		Tiny series keep their data in the header's own node.
 **		Small series will be allocated from a REBOL pool.
 **		Large series will be allocated from system memory.
 **		A width of zero is not allowed.
@@ -759,6 +784,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 ***********************************************************************/
 {
 	REBSER *series;
+	REBCNT node_pool;
 
 	if (C_STACK_OVERFLOWING(&series)) Trap_Stack_Overflow();
 
@@ -775,7 +801,14 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 
 //	if (GC_TRIGGER) Recycle();
 
-	series = cast(REBSER*, Make_Node(SERIES_POOL));
+	// Small series get a bigger node that their data fits in, instead of
+	// a second allocation from the pool for their size
+	node_pool = (!(flags & MKS_EXTERNAL) && length * wide <= SERIES_EMBED_SIZE)
+		? EMBED_POOL
+		: SERIES_POOL;
+
+	series = cast(REBSER*, Make_Node(node_pool));
+	series->node_pool = node_pool;
 
 	if ((GC_Ballast -= sizeof(REBSER)) <= 0) SET_SIGNAL(SIG_RECYCLE);
 
@@ -805,8 +838,13 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	else {
 		// Allocate the actual data blob that holds the series elements
 
-		if (!Series_Data_Alloc(series, length, wide, flags)) {
-			Free_Node(SERIES_POOL, cast(REBNOD*, series));
+		if (!Series_Data_Alloc(
+			series,
+			length,
+			wide,
+			node_pool == EMBED_POOL ? (flags | MKS_EMBED) : flags
+		)) {
+			Free_Node(node_pool, cast(REBNOD*, series));
 			raise Error_No_Memory(length * wide);
 		}
 	}
@@ -939,6 +977,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	REBCNT size_old;
 	REBINT bias_old;
 	REBINT tail_old;
+	REBOOL embedded;
 
 	// ASSERT_SERIES_TERM(series);
 
@@ -1017,6 +1056,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	bias_old = SERIES_BIAS(series);
 	size_old = Series_Allocated_Size(series);
 	tail_old = SERIES_TAIL(series);
+	embedded = SERIES_EMBEDDED(series);
 
 	series->data = NULL;
 	if (!Series_Data_Alloc(
@@ -1043,7 +1083,9 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	series->tail = tail_old + delta;
 
 	// We have to de-bias the data pointer before we can free it.
-	Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
+	// (Data that was in the series node has nothing to free.)
+	if (!embedded)
+		Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
 
 	PG_Reb_Stats->Series_Expanded++;
 }
@@ -1065,6 +1107,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	REBCNT tail_old = series->tail;
 	REBYTE wide_old = SERIES_WIDE(series);
 	REBOOL any_block = Is_Array_Series(series);
+	REBOOL embedded = SERIES_EMBEDDED(series);
 
 	// Extract the data pointer to take responsibility for it.  (The pointer
 	// may have already been extracted if the caller is doing their own
@@ -1111,7 +1154,8 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	else
 		TERM_SEQUENCE(series);
 
-	Free_Unbiased_Series_Data(data_old - (wide_old * bias_old), size_old);
+	if (!embedded)
+		Free_Unbiased_Series_Data(data_old - (wide_old * bias_old), size_old);
 }
 
 
@@ -1146,6 +1190,9 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		// but the data pointer itself is not one that Rebol allocated
 		// !!! Should the external owner be told about the GC/free event?
 	}
+	else if (SERIES_EMBEDDED(series)) {
+		// Data is in the node, and goes away with it
+	}
 	else {
 		REBYTE wide = SERIES_WIDE(series);
 		REBCNT bias = SERIES_BIAS(series);
@@ -1158,7 +1205,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	//series->tail = 0xBAD2BAD2;
 	//series->extra.size = 0xBAD3BAD3;
 
-	Free_Node(SERIES_POOL, cast(REBNOD*, series));
+	Free_Node(series->node_pool, cast(REBNOD*, series));
 
 	if (REB_I32_ADD_OF(GC_Ballast, size, &GC_Ballast)) {
 		GC_Ballast = MAX_I32;
@@ -1233,6 +1280,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	REBINT size_old = Series_Allocated_Size(series);
 	REBCNT tail_old = series->tail;
 	REBYTE wide_old = SERIES_WIDE(series);
+	REBOOL embedded = SERIES_EMBEDDED(series);
 
 	REBYTE *data_old = series->data;
 
@@ -1271,7 +1319,8 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		TERM_SEQUENCE(series);
 	}
 
-	Free_Unbiased_Series_Data(data_old - (wide_old * bias_old), size_old);
+	if (!embedded)
+		Free_Unbiased_Series_Data(data_old - (wide_old * bias_old), size_old);
 
 	ASSERT_SERIES(series);
 }
@@ -1316,6 +1365,11 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 		*current_ptr = *last_ptr;
 	}
 	GC_Manuals->tail--; // !!! Should it ever shrink or save memory?
+
+	// Newly managed series start out young.  A minor recycle only has
+	// to consider the series in the nursery for freeing.
+	if (SERIES_FULL(GC_Nursery)) Extend_Series(GC_Nursery, 8);
+	cast(REBSER **, GC_Nursery->data)[GC_Nursery->tail++] = series;
 }
 
 
@@ -1427,18 +1481,21 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **
 */	REBFLG Series_In_Pool(REBSER *series)
 /*
-**		Confirm that the series value is in the series pool.
+**		Confirm that the series value is in a series pool.
 **
 ***********************************************************************/
 {
 	REBSEG	*seg;
 	REBSER *start;
+	REBCNT pool_num;
 
 	// Scan all series headers to check that series->size is correct:
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		start = (REBSER *) (seg + 1);
-		if (series >= start && series <= (REBSER*)((REBYTE*)start + seg->size - sizeof(REBSER)))
-			return TRUE;
+	for (pool_num = SERIES_POOL; pool_num <= EMBED_POOL; pool_num++) {
+		for (seg = Mem_Pools[pool_num].segs; seg; seg = seg->next) {
+			start = (REBSER *) (seg + 1);
+			if (series >= start && series <= (REBSER*)((REBYTE*)start + seg->size - sizeof(REBSER)))
+				return TRUE;
+		}
 	}
 
 	return FALSE;
@@ -1458,6 +1515,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 ***********************************************************************/
 {
 	REBCNT pool_num;
+	REBCNT node_pool;
 	REBNOD *node;
 	REBCNT count = 0;
 	REBSEG *seg;
@@ -1467,19 +1525,30 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	PG_Reb_Stats->Free_List_Checked++;
 
 	// Scan all series headers to check that series->size is correct:
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		series = (REBSER *) (seg + 1);
-		for (count = Mem_Pools[SERIES_POOL].units; count > 0; count--) {
-			if (!SERIES_FREED(series)) {
-				if (!SERIES_REST(series) || !series->data)
-					goto crash;
-				// Does the size match a known pool?
-				pool_num = FIND_POOL(SERIES_TOTAL(series));
-				// Just to be sure the pool matches the allocation:
-				if (pool_num < SERIES_POOL && Mem_Pools[pool_num].wide != SERIES_TOTAL(series))
-					goto crash;
+	for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+		for (seg = Mem_Pools[node_pool].segs; seg; seg = seg->next) {
+			series = (REBSER *) (seg + 1);
+			for (count = Mem_Pools[node_pool].units; count > 0; count--) {
+				if (!SERIES_FREED(series)) {
+					if (!SERIES_REST(series) || !series->data)
+						goto crash;
+					if (series->node_pool != node_pool)
+						goto crash;
+					// Does the size match a known pool?
+					pool_num = FIND_POOL(SERIES_TOTAL(series));
+					// Just to be sure the pool matches the allocation.
+					// (The pool unit may have a remainder smaller than
+					// one element, if the width doesn't divide it.)
+					if (
+						!SERIES_EMBEDDED(series)
+						&& pool_num < SERIES_POOL
+						&& Mem_Pools[pool_num].wide - SERIES_TOTAL(series)
+							>= SERIES_WIDE(series)
+					)
+						goto crash;
+				}
+				series = NEXT_SERIES_NODE(series, node_pool);
 			}
-			series++;
 		}
 	}
 
@@ -1521,17 +1590,20 @@ crash:
 	REBSER *series;
 	REBCNT count;
 	REBCNT n = 0;
-
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		series = (REBSER *) (seg + 1);
-		for (count = Mem_Pools[SERIES_POOL].units; count > 0; count--) {
-			if (!SERIES_FREED(series)) {
-				if (SERIES_WIDE(series) == size) {
-					//Debug_Fmt("%3d %4d %4d = \"%s\"", n++, series->tail, SERIES_TOTAL(series), series->data);
-					Debug_Fmt("%3d %4d %4d = \"%s\"", n++, series->tail, SERIES_REST(series), (SERIES_LABEL(series) ? SERIES_LABEL(series) : "-"));
+	REBCNT node_pool;
+
+	for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+		for (seg = Mem_Pools[node_pool].segs; seg; seg = seg->next) {
+			series = (REBSER *) (seg + 1);
+			for (count = Mem_Pools[node_pool].units; count > 0; count--) {
+				if (!SERIES_FREED(series)) {
+					if (SERIES_WIDE(series) == size) {
+						//Debug_Fmt("%3d %4d %4d = \"%s\"", n++, series->tail, SERIES_TOTAL(series), series->data);
+						Debug_Fmt("%3d %4d %4d = \"%s\"", n++, series->tail, SERIES_REST(series), (SERIES_LABEL(series) ? SERIES_LABEL(series) : "-"));
+					}
 				}
+				series = NEXT_SERIES_NODE(series, node_pool);
 			}
-			series++;
 		}
 	}
 }
@@ -1548,36 +1620,39 @@ crash:
 	REBSER *series;
 	REBCNT count;
 	REBCNT n = 0;
-
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		series = (REBSER *) (seg + 1);
-		for (count = Mem_Pools[SERIES_POOL].units; count > 0; count--) {
-			if (!SERIES_FREED(series)) {
-				if (
-					pool_id == UNKNOWN
-					|| FIND_POOL(SERIES_TOTAL(series)) == pool_id
-				) {
-					Debug_Fmt(
-							  Str_Dump, //"%s Series %x %s: Wide: %2d Size: %6d - Bias: %d Tail: %d Rest: %d Flags: %x"
-							  "Dump",
-							  series,
-							  (SERIES_LABEL(series) ? SERIES_LABEL(series) : "-"),
-							  SERIES_WIDE(series),
-							  SERIES_TOTAL(series),
-							  SERIES_BIAS(series),
-							  SERIES_TAIL(series),
-							  SERIES_REST(series),
-							  SERIES_FLAGS(series)
-							 );
-					//Dump_Series(series, "Dump");
-					if (Is_Array_Series(series)) {
-						Debug_Values(BLK_HEAD(series), SERIES_TAIL(series), 1024); /* FIXME limit */
-					} else{
-						Dump_Bytes(series->data, (SERIES_TAIL(series)+1) * SERIES_WIDE(series));
+	REBCNT node_pool;
+
+	for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+		for (seg = Mem_Pools[node_pool].segs; seg; seg = seg->next) {
+			series = (REBSER *) (seg + 1);
+			for (count = Mem_Pools[node_pool].units; count > 0; count--) {
+				if (!SERIES_FREED(series)) {
+					if (
+						pool_id == UNKNOWN
+						|| FIND_POOL(SERIES_TOTAL(series)) == pool_id
+					) {
+						Debug_Fmt(
+								  Str_Dump, //"%s Series %x %s: Wide: %2d Size: %6d - Bias: %d Tail: %d Rest: %d Flags: %x"
+								  "Dump",
+								  series,
+								  (SERIES_LABEL(series) ? SERIES_LABEL(series) : "-"),
+								  SERIES_WIDE(series),
+								  SERIES_TOTAL(series),
+								  SERIES_BIAS(series),
+								  SERIES_TAIL(series),
+								  SERIES_REST(series),
+								  SERIES_FLAGS(series)
+								 );
+						//Dump_Series(series, "Dump");
+						if (Is_Array_Series(series)) {
+							Debug_Values(BLK_HEAD(series), SERIES_TAIL(series), 1024); /* FIXME limit */
+						} else{
+							Dump_Bytes(series->data, (SERIES_TAIL(series)+1) * SERIES_WIDE(series));
+						}
 					}
 				}
+				series = NEXT_SERIES_NODE(series, node_pool);
 			}
-			series++;
 		}
 	}
 }
@@ -1638,6 +1713,7 @@ crash:
 	REBCNT  str_size, uni_size, blk_size, odd_size, seg_size, fre_size;
 	REBFLG  f = 0;
 	REBINT  pool_num;
+	REBCNT  node_pool;
 #ifdef SERIES_LABELS
 	REBYTE  *kind;
 #endif
@@ -1647,59 +1723,61 @@ crash:
 	seg_size = str_size = uni_size = blk_size = odd_size = fre_size = 0;
 	tot_size = 0;
 
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
+	for (node_pool = SERIES_POOL; node_pool <= EMBED_POOL; node_pool++) {
+		for (seg = Mem_Pools[node_pool].segs; seg; seg = seg->next) {
 
-		seg_size += seg->size;
-		segs++;
+			seg_size += seg->size;
+			segs++;
 
-		series = (REBSER *) (seg + 1);
+			series = (REBSER *) (seg + 1);
 
-		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--) {
+			for (n = Mem_Pools[node_pool].units; n > 0; n--) {
 
-			if (SERIES_WIDE(series)) {
-				tot++;
-				tot_size += SERIES_TOTAL(series);
-				f = 0;
-			} else {
-				fre++;
-			}
+				if (SERIES_WIDE(series)) {
+					tot++;
+					tot_size += SERIES_TOTAL(series);
+					f = 0;
+				} else {
+					fre++;
+				}
 
-#ifdef SERIES_LABELS
-			kind = "----";
-			//if (Find_Root(series)) kind = "ROOT";
-			if (!SERIES_FREED(series) && series->label) {
-				Debug_Fmt_("%08x: %16s %s ", series, series->label, kind);
-				f = 1;
-			} else if (!SERIES_FREED(series) && (flags & 0x100)) {
-				Debug_Fmt_("%08x: %s ", series, kind);
-				f = 1;
-			}
-#endif
-			if (Is_Array_Series(series)) {
-				blks++;
-				blk_size += SERIES_TOTAL(series);
-				if (f) Debug_Fmt_("BLOCK ");
-			}
-			else if (SERIES_WIDE(series) == 1) {
-				strs++;
-				str_size += SERIES_TOTAL(series);
-				if (f) Debug_Fmt_("STRING");
-			}
-			else if (SERIES_WIDE(series) == sizeof(REBUNI)) {
-				unis++;
-				uni_size += SERIES_TOTAL(series);
-				if (f) Debug_Fmt_("UNICOD");
-			}
-			else if (SERIES_WIDE(series)) {
-				odds++;
-				odd_size += SERIES_TOTAL(series);
-				if (f) Debug_Fmt_("ODD[%d]", SERIES_WIDE(series));
-			}
-			if (f && SERIES_WIDE(series)) {
-				Debug_Fmt(" units: %-5d tail: %-5d bytes: %-7d", SERIES_REST(series), SERIES_TAIL(series), SERIES_TOTAL(series));
-			}
+	#ifdef SERIES_LABELS
+				kind = "----";
+				//if (Find_Root(series)) kind = "ROOT";
+				if (!SERIES_FREED(series) && series->label) {
+					Debug_Fmt_("%08x: %16s %s ", series, series->label, kind);
+					f = 1;
+				} else if (!SERIES_FREED(series) && (flags & 0x100)) {
+					Debug_Fmt_("%08x: %s ", series, kind);
+					f = 1;
+				}
+	#endif
+				if (Is_Array_Series(series)) {
+					blks++;
+					blk_size += SERIES_TOTAL(series);
+					if (f) Debug_Fmt_("BLOCK ");
+				}
+				else if (SERIES_WIDE(series) == 1) {
+					strs++;
+					str_size += SERIES_TOTAL(series);
+					if (f) Debug_Fmt_("STRING");
+				}
+				else if (SERIES_WIDE(series) == sizeof(REBUNI)) {
+					unis++;
+					uni_size += SERIES_TOTAL(series);
+					if (f) Debug_Fmt_("UNICOD");
+				}
+				else if (SERIES_WIDE(series)) {
+					odds++;
+					odd_size += SERIES_TOTAL(series);
+					if (f) Debug_Fmt_("ODD[%d]", SERIES_WIDE(series));
+				}
+				if (f && SERIES_WIDE(series)) {
+					Debug_Fmt(" units: %-5d tail: %-5d bytes: %-7d", SERIES_REST(series), SERIES_TAIL(series), SERIES_TOTAL(series));
+				}
 
-			series++;
+				series = NEXT_SERIES_NODE(series, node_pool);
+			}
 		}
 	}
 
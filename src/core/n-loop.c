@@ -79,7 +79,7 @@ typedef enum {
 **
 */	static REBSER *Init_Loop(const REBVAL *spec, REBVAL *body_blk, REBSER **fram)
 /*
-**		Initialize standard for loops (copy block, make frame, bind).
+**		Initialize standard for loops (make frame, copy block and bind).
 **		Spec: WORD or [WORD ...]
 **
 **		Note that because we are copying the block in order to rebind it, the
@@ -127,10 +127,10 @@ typedef enum {
 	SET_END(word);
 	SET_END(vals);
 
-	body = Copy_Array_At_Deep_Managed(
-		VAL_SERIES(body_blk), VAL_INDEX(body_blk)
+	// Only the parts of the body that use the loop's words are copied
+	body = Copy_Bind_Array_At_Managed(
+		VAL_SERIES(body_blk), VAL_INDEX(body_blk), frame
 	);
-	Bind_Values_Deep(BLK_HEAD(body), frame);
 
 	*fram = frame;
 
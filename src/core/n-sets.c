@@ -36,6 +36,67 @@ enum {
 	SOP_FLAG_INVERT = 1 << 2 // invert the result of the search
 };
 
+// Strings and binaries are deduplicated by character (or the first
+// character of each /SKIP record), so membership is kept in a bitmap
+// with one bit per possible REBUNI...or per byte, when all the keys
+// of the inputs are under 256 (see Byte_Set_Keys).
+#define SOP_CHAR_KEY(c, cased) \
+	((!(cased) && (c) < UNICODE_CASES) ? LO_CASE(c) : (c))
+#define SOP_BIT_SET(bits, c) \
+	((bits)[(c) >> 3] |= cast(REBYTE, 1 << ((c) & 7)))
+#define SOP_BIT_TEST(bits, c) \
+	((bits)[(c) >> 3] & (1 << ((c) & 7)))
+
+// Blocks with up to this many values in all are searched directly rather
+// than hashed (the direct search measured faster at 8 values, but was
+// already slower for some operations at 12 and for all of them at 16)
+#define SOP_LINEAR_MAX 10
+
+
+/***********************************************************************
+**
+*/	static REBFLG Linear_Set_Keys(const REBVAL *block)
+/*
+**		TRUE if every value of the block is a word, string or integer,
+**		which Find_Key_Linear() matches exactly as Find_Key() does.
+**		(Decimals, money and dates compare equal when only close, so
+**		whether two of them meet depends on how the table hashes them.)
+**
+***********************************************************************/
+{
+	const REBVAL *val;
+
+	for (val = VAL_BLK_DATA(block); NOT_END(val); val++) {
+		if (!ANY_WORD(val) && !ANY_BINSTR(val) && !IS_INTEGER(val))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Byte_Set_Keys(const REBVAL *val, REBFLG cased)
+/*
+**		TRUE if every char of the string (or byte of the binary) has
+**		a key under 256, so that a byte-sized bitmap will do.  That is
+**		always so for byte-sized series, as lowercasing Latin-1 never
+**		leaves Latin-1.
+**
+***********************************************************************/
+{
+	REBSER *ser = VAL_SERIES(val);
+	REBCNT n;
+
+	if (BYTE_SIZE(ser)) return TRUE;
+
+	for (n = VAL_INDEX(val); n < VAL_TAIL(val); n++) {
+		if (SOP_CHAR_KEY(GET_ANY_CHAR(ser, n), cased) > 0xFF)
+			return FALSE;
+	}
+	return TRUE;
+}
+
 
 /***********************************************************************
 **
@@ -93,37 +154,59 @@ enum {
 
 	if (ANY_ARRAY(val1)) {
 		REBSER *hser = 0;	// hash table for series
-		REBSER *hret;		// hash table for return series
+		REBSER *hret = 0;	// hash table for return series
+		REBFLG linear;		// search the values directly, without hashing
 
 		buffer = BUF_EMIT;			// use preallocated shared block
 		Resize_Series(buffer, i);
-		hret = Make_Hash_Sequence(i);	// allocated
 
-		// Optimization note: !!
-		// This code could be optimized for small blocks by not hashing them
-		// and extending Find_Key to do a FIND on the value itself w/o the hash.
+		// Hashing costs more than it saves on small blocks.  (Records of
+		// more than one value, and keys that are not matched exactly, go
+		// through the hash path as they always did.)
+		linear = (
+			skip == 1 && i <= SOP_LINEAR_MAX
+			&& Linear_Set_Keys(val1) && (!val2 || Linear_Set_Keys(val2))
+		);
+		if (!linear)
+			hret = Make_Hash_Sequence(i);	// allocated
 
 		do {
 			REBSER *ser = VAL_SERIES(val1); // val1 and val2 swapped 2nd pass!
 
 			// Check what is in series1 but not in series2:
-			if (flags & SOP_FLAG_CHECK)
-				hser = Hash_Block(val2, cased);
+			if (flags & SOP_FLAG_CHECK) {
+				if (!linear)
+					hser = Hash_Block(val2, cased);
+			}
 
 			// Iterate over first series:
 			i = VAL_INDEX(val1);
 			for (; i < SERIES_TAIL(ser); i += skip) {
 				REBVAL *item = BLK_SKIP(ser, i);
 				if (flags & SOP_FLAG_CHECK) {
-					h = Find_Key(VAL_SERIES(val2), hser, item, skip, cased, 1);
-					h = (h >= 0);
+					if (linear)
+						h = Find_Key_Linear(
+							VAL_BLK_DATA(val2), VAL_LEN(val2), item, cased
+						) != NOT_FOUND;
+					else
+						h = Find_Key(
+							VAL_SERIES(val2), hser, item, skip, cased, 1
+						) >= 0;
 					if (flags & SOP_FLAG_INVERT) h = !h;
 				}
-				if (h) Find_Key(buffer, hret, item, skip, cased, 2);
+				if (!h) continue;
+				if (!linear)
+					Find_Key(buffer, hret, item, skip, cased, 2);
+				else if (NOT_FOUND == Find_Key_Linear(
+					BLK_HEAD(buffer), SERIES_TAIL(buffer), item, cased
+				))
+					Append_Value(buffer, item);
 			}
 
-			if (flags & SOP_FLAG_CHECK)
+			if (hser) {
 				Free_Series(hser);
+				hser = 0;
+			}
 
 			if (!first_pass) break;
 			first_pass = FALSE;
@@ -143,12 +226,35 @@ enum {
 		RESET_TAIL(buffer); // required - allow reuse
 	}
 	else {
+		REBYTE byte_maps[(256 / 8) * 2];
+		REBSER *bitmaps = NULL;	// bits for the result, then for the other
+		REBYTE *in_buffer;
+		REBYTE *in_other;
+		REBCNT num_bytes;
+
 		if (IS_BINARY(val1)) {
 			// All binaries use "case-sensitive" comparison (e.g. each byte
 			// is treated distinctly)
 			cased = TRUE;
 		}
 
+		// Most strings need only the byte-sized bitmap, which is small
+		// enough to keep on the C stack (and to clear for every call)
+		if (
+			Byte_Set_Keys(val1, cased)
+			&& (!val2 || Byte_Set_Keys(val2, cased))
+		) {
+			num_bytes = 256 / 8;
+			in_buffer = byte_maps;
+		}
+		else {
+			num_bytes = 65536 / 8;
+			bitmaps = Make_Binary(num_bytes * 2);
+			in_buffer = BIN_DATA(bitmaps);
+		}
+		in_other = in_buffer + num_bytes;
+		CLEAR(in_buffer, num_bytes);
+
 		buffer = BUF_MOLD;
 		Reset_Buffer(buffer, i);
 		RESET_TAIL(buffer);
@@ -157,37 +263,31 @@ enum {
 			REBSER *ser = VAL_SERIES(val1); // val1 and val2 swapped 2nd pass!
 			REBUNI uc;
 
+			// Note which chars (or record heads) the other series has,
+			// stepping through it in the same way FIND/SKIP would
+			if (flags & SOP_FLAG_CHECK) {
+				REBSER *other = VAL_SERIES(val2);
+
+				CLEAR(in_other, num_bytes);
+				for (i = VAL_INDEX(val2); i < VAL_TAIL(val2); i += skip) {
+					uc = GET_ANY_CHAR(other, i);
+					SOP_BIT_SET(in_other, SOP_CHAR_KEY(uc, cased));
+				}
+			}
+
 			// Iterate over first series:
 			i = VAL_INDEX(val1);
 			for (; i < SERIES_TAIL(ser); i += skip) {
-				uc = GET_ANY_CHAR(ser, i);
+				uc = SOP_CHAR_KEY(GET_ANY_CHAR(ser, i), cased);
 				if (flags & SOP_FLAG_CHECK) {
-					h = (NOT_FOUND != Find_Str_Char(
-						VAL_SERIES(val2),
-						0,
-						VAL_INDEX(val2),
-						VAL_TAIL(val2),
-						skip,
-						uc,
-						cased ? AM_FIND_CASE : 0
-					));
-
+					h = SOP_BIT_TEST(in_other, uc) != 0;
 					if (flags & SOP_FLAG_INVERT) h = !h;
 				}
 
 				if (!h) continue;
 
-				if (
-					NOT_FOUND == Find_Str_Char(
-						buffer,
-						0,
-						0,
-						SERIES_TAIL(buffer),
-						skip,
-						uc,
-						cased ? AM_FIND_CASE : 0
-					)
-				) {
+				if (!SOP_BIT_TEST(in_buffer, uc)) {
+					SOP_BIT_SET(in_buffer, uc);
 					Append_String(buffer, ser, i, skip);
 				}
 			}
@@ -203,6 +303,8 @@ enum {
 			}
 		} while (i);
 
+		if (bitmaps) Free_Series(bitmaps);
+
 		out_ser = Copy_String(buffer, 0, -1);
 	}
 
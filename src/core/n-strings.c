@@ -118,6 +118,51 @@ static struct digest {
 };
 
 
+// Running state of a CHECKSUM port (see p-checksum.c), held in a BINARY!
+struct Reb_Checksum {
+	REBINT sym;		// SYM_CRC32, SYM_ADLER32, or that of one of the digests
+	REBCNT digest;	// index into digests[]
+	REBCNT sum;		// running CRC32 or ADLER32
+	REBFLG hmac;
+	REBYTE opad[64];	// Size must be max of all digest[].hmacblock;
+	REBI64 ctx[1];	// digest context (ctxsize() bytes)
+};
+
+#define CHECKSUM_SIZE(ctxsize) \
+	(offsetof(struct Reb_Checksum, ctx) + (ctxsize))
+
+
+/***********************************************************************
+**
+*/	static void Make_Hmac_Pads(REBCNT i, REBYTE *key, REBCNT keylen, REBYTE *ipad, REBYTE *opad)
+/*
+**		Fill the inner and outer key blocks for an HMAC of digest i.
+**		Keys longer than a block are hashed first (RFC 2104).
+**
+***********************************************************************/
+{
+	REBYTE tmpdigest[20];		// Size must be max of all digest[].len;
+	int blocklen = digests[i].hmacblock;
+	REBINT j;
+
+	if (keylen > cast(REBCNT, blocklen)) {
+		digests[i].digest(key, keylen, tmpdigest);
+		key = tmpdigest;
+		keylen = digests[i].len;
+	}
+
+	memset(ipad, 0, blocklen);
+	memset(opad, 0, blocklen);
+	memcpy(ipad, key, keylen);
+	memcpy(opad, key, keylen);
+
+	for (j = 0; j < blocklen; j++) {
+		ipad[j]^=0x36;
+		opad[j]^=0x5c;
+	}
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(ajoin)
@@ -238,28 +283,22 @@ static struct digest {
 				if (D_REF(ARG_CHECKSUM_KEY)) {
 					REBYTE tmpdigest[20];		// Size must be max of all digest[].len;
 					REBYTE ipad[64],opad[64];	// Size must be max of all digest[].hmacblock;
-					char *ctx = ALLOC_ARRAY(char, digests[i].ctxsize());
-					REBVAL *key = D_ARG(ARG_CHECKSUM_KEY_VALUE);
-					REBYTE *keycp = VAL_BIN_DATA(key);
-					int keylen = VAL_LEN(key);
+					char *ctx;
 					int blocklen = digests[i].hmacblock;
-					REBINT j;
+					REBSER *key;
+					REBCNT index;
+					REBCNT key_len = 0;
 
-					if (keylen > blocklen) {
-						digests[i].digest(keycp,keylen,tmpdigest);
-						keycp = tmpdigest;
-						keylen = digests[i].len;
-					}
+					// Strings are keyed by their UTF-8 (as the CHECKSUM
+					// port does, see Make_Checksum_Stream)
+					key = Temp_Bin_Str_Managed(
+						D_ARG(ARG_CHECKSUM_KEY_VALUE), &index, &key_len
+					);
+					Make_Hmac_Pads(
+						i, BIN_SKIP(key, index), key_len, ipad, opad
+					);
 
-					memset(ipad, 0, blocklen);
-					memset(opad, 0, blocklen);
-					memcpy(ipad, keycp, keylen);
-					memcpy(opad, keycp, keylen);
-
-					for (j = 0; j < blocklen; j++) {
-						ipad[j]^=0x36;
-						opad[j]^=0x5c;
-					}
+					ctx = ALLOC_ARRAY(char, digests[i].ctxsize());
 
 					digests[i].init(ctx);
 					digests[i].update(ctx,ipad,blocklen);
@@ -294,7 +333,7 @@ static struct digest {
 		REBINT hash;
 		REBINT sum = VAL_INT32(D_ARG(ARG_CHECKSUM_SIZE)); // /size
 		if (sum <= 1) sum = 1;
-		hash = Hash_String(data, len) % sum;
+		hash = Hash_String_CRC(data, len) % sum;
 		SET_INTEGER(D_OUT, hash);
 	}
 	else {
@@ -306,6 +345,141 @@ static struct digest {
 }
 
 
+/***********************************************************************
+**
+*/	static REBSER *Make_Checksum_State(REBCNT ctxsize)
+/*
+***********************************************************************/
+{
+	REBSER *state = Make_Binary(CHECKSUM_SIZE(ctxsize));
+
+	CLEAR(BIN_HEAD(state), CHECKSUM_SIZE(ctxsize));
+	SERIES_TAIL(state) = CHECKSUM_SIZE(ctxsize);
+	TERM_SEQUENCE(state);
+
+	return state;
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Make_Checksum_Stream(const REBVAL *method, REBVAL *key)
+/*
+**		Start a running checksum, for any method CHECKSUM/METHOD
+**		takes.  With a key (BINARY! or ANY-STRING!, else NONE!) it
+**		is an HMAC, as with CHECKSUM/KEY.  Returns the BINARY! that
+**		holds its state, for Checksum_Stream_Update() and _Result().
+**
+***********************************************************************/
+{
+	REBINT sym = VAL_WORD_CANON(method);
+	struct Reb_Checksum *cs;
+	REBSER *state;
+	REBCNT i;
+
+	if (sym == SYM_CRC32 || sym == SYM_ADLER32) {
+		if (!IS_NONE(key)) raise Error_Invalid_Arg(key);
+
+		state = Make_Checksum_State(0);
+		cs = cast(struct Reb_Checksum*, BIN_HEAD(state));
+		cs->sym = sym;
+		cs->sum = 0; // ADLER32 starts from 0 (not 1) to match CHECKSUM
+		return state;
+	}
+
+	for (i = 0; digests[i].digest; i++) {
+		if (digests[i].index == sym) break;
+	}
+	if (!digests[i].digest) raise Error_Invalid_Arg(method);
+
+	state = Make_Checksum_State(digests[i].ctxsize());
+	cs = cast(struct Reb_Checksum*, BIN_HEAD(state));
+	cs->sym = sym;
+	cs->digest = i;
+
+	digests[i].init(cs->ctx);
+
+	if (!IS_NONE(key)) {
+		REBYTE ipad[64];	// Size must be max of all digest[].hmacblock;
+		REBSER *ser;
+		REBCNT index;
+		REBCNT len = 0;
+
+		if (!IS_BINARY(key) && !ANY_STR(key)) raise Error_Invalid_Arg(key);
+		ser = Temp_Bin_Str_Managed(key, &index, &len);
+
+		Make_Hmac_Pads(i, BIN_SKIP(ser, index), len, ipad, cs->opad);
+		digests[i].update(cs->ctx, ipad, digests[i].hmacblock);
+		cs->hmac = TRUE;
+	}
+
+	return state;
+}
+
+
+/***********************************************************************
+**
+*/	void Checksum_Stream_Update(REBSER *state, const REBYTE *data, REBCNT len)
+/*
+***********************************************************************/
+{
+	struct Reb_Checksum *cs = cast(struct Reb_Checksum*, BIN_HEAD(state));
+
+	if (cs->sym == SYM_CRC32)
+		cs->sum = Update_CRC32(cs->sum, m_cast(REBYTE*, data), len);
+	else if (cs->sym == SYM_ADLER32)
+		cs->sum = z_adler32(cs->sum, data, len);
+	else
+		digests[cs->digest].update(cs->ctx, m_cast(REBYTE*, data), len);
+}
+
+
+/***********************************************************************
+**
+*/	void Checksum_Stream_Result(REBVAL *out, REBSER *state)
+/*
+**		The checksum of all data given so far, in the same form as
+**		CHECKSUM returns it.  The stream itself can carry on.
+**
+***********************************************************************/
+{
+	struct Reb_Checksum *cs = cast(struct Reb_Checksum*, BIN_HEAD(state));
+	REBCNT i = cs->digest;
+	REBSER *digest;
+	char *ctx;
+
+	if (cs->sym == SYM_CRC32) {
+		SET_INTEGER(out, cast(REBINT, cs->sum)); // signed, as CHECKSUM gives
+		return;
+	}
+	if (cs->sym == SYM_ADLER32) {
+		SET_INTEGER(out, cs->sum);
+		return;
+	}
+
+	digest = Make_Series(digests[i].len + 1, sizeof(char), FALSE);
+	LABEL_SERIES(digest, "checksum digest");
+
+	// Finish a copy of the context, so that more data can still be added
+	ctx = ALLOC_ARRAY(char, digests[i].ctxsize());
+	memcpy(ctx, cs->ctx, digests[i].ctxsize());
+	digests[i].final(BIN_HEAD(digest), ctx);
+
+	if (cs->hmac) {
+		digests[i].init(ctx);
+		digests[i].update(ctx, cs->opad, digests[i].hmacblock);
+		digests[i].update(ctx, BIN_HEAD(digest), digests[i].len);
+		digests[i].final(BIN_HEAD(digest), ctx);
+	}
+
+	FREE_ARRAY(char, digests[i].ctxsize(), ctx);
+
+	SERIES_TAIL(digest) = digests[i].len;
+	TERM_SEQUENCE(digest);
+	Val_Init_Binary(out, digest);
+}
+
+
 /***********************************************************************
 **
 */	REBNATIVE(compress)
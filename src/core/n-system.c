@@ -105,6 +105,10 @@
 		SET_INT32(TASK_BALLAST, 0);
 	}
 
+	if (D_REF(6)) { // budget
+		GC_Sweep_Budget = Int32s(D_ARG(7), 0);
+	}
+
 	count = Recycle();
 
 	SET_INTEGER(D_OUT, count);
@@ -167,6 +171,15 @@
 
 			stats++;
 			SET_INTEGER(stats, PG_Reb_Stats->Recycle_Counter);
+			stats++;
+			SET_INTEGER(stats, PG_Reb_Stats->Recycle_Minor);
+
+			stats++;
+			VAL_TIME(stats) = PG_Reb_Stats->Recycle_Minor_Time * 1000;
+			VAL_SET(stats, REB_TIME);
+			stats++;
+			VAL_TIME(stats) = PG_Reb_Stats->Recycle_Major_Time * 1000;
+			VAL_SET(stats, REB_TIME);
 		}
 		return R_OUT;
 	}
@@ -0,0 +1,136 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  Copyright 2015 Rebol Open Source Contributors
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  p-checksum.c
+**  Summary: running checksum port interface
+**  Section: ports
+**  Author:  Ren/C contributors
+**  Notes:
+**
+**		A CHECKSUM port hashes the data written to it a piece at a
+**		time, so that a large file or a network transfer can be hashed
+**		without holding it all in one series:
+**
+**			sum: open [scheme: 'checksum method: 'sha1]
+**			in: open %big.iso
+**			until [
+**				write sum data: read/part in 65536
+**				empty? data
+**			]
+**			print read sum
+**
+**		READ gives the checksum of everything written so far, in the
+**		same form as CHECKSUM/METHOD (or CHECKSUM/KEY, when the spec
+**		has a KEY), and more can be written after it.
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+
+/***********************************************************************
+**
+*/	static REB_R Checksum_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action)
+/*
+***********************************************************************/
+{
+	REBVAL *state;
+	REBVAL *spec;
+	REBVAL *arg;
+	REBSER *ser;
+	REBCNT index;
+	REBCNT len;
+
+	Validate_Port(port, action);
+
+	state = BLK_SKIP(port, STD_PORT_STATE);
+	spec = BLK_SKIP(port, STD_PORT_SPEC);
+
+	if (!IS_BINARY(state)) {
+		switch (action) {
+		case A_OPEN:
+			arg = Obj_Value(spec, STD_PORT_SPEC_CHECKSUM_METHOD);
+			if (!IS_WORD(arg)) raise Error_1(RE_INVALID_SPEC, arg);
+
+			Val_Init_Binary(state, Make_Checksum_Stream(
+				arg, Obj_Value(spec, STD_PORT_SPEC_CHECKSUM_KEY)
+			));
+			return R_ARG1;
+
+		case A_CLOSE:
+			return R_ARG1;
+
+		case A_OPENQ:
+			return R_FALSE;
+
+		default:
+			raise Error_On_Port(RE_NOT_OPEN, port, 0);
+		}
+	}
+
+	switch (action) {
+	case A_WRITE:
+		arg = D_ARG(2);
+		if (!IS_BINARY(arg) && !IS_STRING(arg))
+			raise Error_1(RE_INVALID_ARG, arg);
+
+		len = VAL_LEN(arg);
+		if (D_REF(ARG_WRITE_PART)) {
+			REBCNT n = Int32s(D_ARG(ARG_WRITE_LIMIT), 0);
+			if (n <= len) len = n;
+		}
+		if (len == 0) return R_ARG1;
+
+		ser = Temp_Bin_Str_Managed(arg, &index, &len);
+		Checksum_Stream_Update(VAL_SERIES(state), BIN_SKIP(ser, index), len);
+		return R_ARG1;
+
+	case A_READ:
+		Checksum_Stream_Result(D_OUT, VAL_SERIES(state));
+		return R_OUT;
+
+	case A_CLOSE:
+		SET_NONE(state);
+		return R_ARG1;
+
+	case A_OPENQ:
+		return R_TRUE;
+
+	case A_OPEN:
+		raise Error_1(RE_ALREADY_OPEN, D_ARG(1));
+
+	default:
+		raise Error_Illegal_Action(REB_PORT, action);
+	}
+
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	void Init_Checksum_Scheme(void)
+/*
+***********************************************************************/
+{
+	Register_Scheme(SYM_CHECKSUM, 0, Checksum_Actor);
+}
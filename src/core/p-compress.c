@@ -0,0 +1,204 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  Copyright 2015 Rebol Open Source Contributors
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  p-compress.c
+**  Summary: streaming compression port interface
+**  Section: ports
+**  Author:  Ren/C contributors
+**  Notes:
+**
+**		DEFLATE and INFLATE ports run data through zlib a chunk at a
+**		time, so that neither the input nor the output ever has to be
+**		held in memory all at once (unlike COMPRESS and DECOMPRESS).
+**		WRITE feeds data in, and READ takes what has come out so far.
+**		At most 32K of output is made ahead of a READ (the rest of the
+**		input waits in the port), so READ until it gives back nothing:
+**
+**			in: open %big.log.gz
+**			out: open/new %big.log
+**			z: open [scheme: 'inflate gzip: true]
+**			until [
+**				write z data: read/part in 65536
+**				while [not empty? part: read z] [write out part]
+**				empty? data
+**			]
+**			update z ; error if the compressed data was cut short
+**			close z close in close out
+**
+**		For DEFLATE, UPDATE ends the stream, and the rest of the output
+**		is then available to READ until TAIL? is true.  The spec's GZIP and ONLY fields
+**		match the refinements of COMPRESS, so a DEFLATE port's output
+**		is what COMPRESS would have made of the whole input.
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+
+/***********************************************************************
+**
+*/	static REB_R Zlib_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action, REBFLG deflating)
+/*
+***********************************************************************/
+{
+	REBVAL *state;
+	REBVAL *data;
+	REBVAL *spec;
+	REBVAL *arg;
+	REBSER *ser;
+	REBCNT index;
+	REBCNT len;
+
+	Validate_Port(port, action);
+
+	state = BLK_SKIP(port, STD_PORT_STATE);
+	data = BLK_SKIP(port, STD_PORT_DATA);
+	spec = BLK_SKIP(port, STD_PORT_SPEC);
+
+	if (!IS_BLOCK(state)) {
+		switch (action) {
+		case A_OPEN:
+			Val_Init_Block(state, Make_Zlib_Stream(
+				deflating,
+				IS_CONDITIONAL_TRUE(Obj_Value(spec, STD_PORT_SPEC_ZLIB_GZIP)),
+				IS_CONDITIONAL_TRUE(Obj_Value(spec, STD_PORT_SPEC_ZLIB_ONLY))
+			));
+			Val_Init_Binary(data, Make_Binary(0));
+			return R_ARG1;
+
+		case A_CLOSE:
+			return R_ARG1;
+
+		case A_OPENQ:
+			return R_FALSE;
+
+		default:
+			raise Error_On_Port(RE_NOT_OPEN, port, 0);
+		}
+	}
+
+	switch (action) {
+	case A_WRITE:
+		arg = D_ARG(2);
+		if (!IS_BINARY(arg) && !IS_STRING(arg))
+			raise Error_1(RE_INVALID_ARG, arg);
+
+		len = VAL_LEN(arg);
+		if (D_REF(ARG_WRITE_PART)) {
+			REBCNT n = Int32s(D_ARG(ARG_WRITE_LIMIT), 0);
+			if (n <= len) len = n;
+		}
+
+		// A compression stream that was ended can take no more input
+		// (decompression just ignores what comes after its end)
+		if (
+			deflating && len != 0
+			&& Zlib_Stream_Finishing(VAL_SERIES(state))
+		)
+			raise Error_On_Port(RE_WRITE_ERROR, port, 0);
+
+		if (len == 0) return R_ARG1;
+
+		ser = Temp_Bin_Str_Managed(arg, &index, &len);
+		Zlib_Stream_Run(
+			VAL_SERIES(state), VAL_SERIES(data), BIN_SKIP(ser, index), len,
+			FALSE
+		);
+		return R_ARG1;
+
+	case A_READ:
+		// Let the stream go on with input it has not used yet, then
+		// take the output from the front of the buffer, which is kept
+		// (and so not reallocated as it fills again)
+		ser = VAL_SERIES(data);
+		Zlib_Stream_Run(VAL_SERIES(state), ser, NULL, 0, FALSE);
+		len = SERIES_TAIL(ser);
+		if (D_REF(ARG_READ_PART)) {
+			REBCNT n = Int32s(D_ARG(ARG_READ_LIMIT), 0);
+			if (n < len) len = n;
+		}
+		Val_Init_Binary(D_OUT, Copy_Bytes(BIN_HEAD(ser), len));
+		Remove_Series(ser, 0, len);
+		return R_OUT;
+
+	case A_UPDATE:
+		Zlib_Stream_Run(VAL_SERIES(state), VAL_SERIES(data), NULL, 0, TRUE);
+		return R_ARG1;
+
+	case A_TAILQ:
+		// The stream has ended and all of its output has been read
+		if (
+			SERIES_TAIL(VAL_SERIES(data)) == 0
+			&& Zlib_Stream_Ended(VAL_SERIES(state))
+		) return R_TRUE;
+		return R_FALSE;
+
+	case A_CLOSE:
+		// The stream's memory all belongs to the state block (see
+		// Make_Zlib_Stream), so the GC takes care of it.
+		SET_NONE(state);
+		SET_NONE(data);
+		return R_ARG1;
+
+	case A_OPENQ:
+		return R_TRUE;
+
+	case A_OPEN:
+		raise Error_1(RE_ALREADY_OPEN, D_ARG(1));
+
+	default:
+		raise Error_Illegal_Action(REB_PORT, action);
+	}
+
+	return R_OUT;
+}
+
+
+/***********************************************************************
+**
+*/	static REB_R Deflate_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action)
+/*
+***********************************************************************/
+{
+	return Zlib_Actor(call_, port, action, TRUE);
+}
+
+
+/***********************************************************************
+**
+*/	static REB_R Inflate_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action)
+/*
+***********************************************************************/
+{
+	return Zlib_Actor(call_, port, action, FALSE);
+}
+
+
+/***********************************************************************
+**
+*/	void Init_Compress_Scheme(void)
+/*
+***********************************************************************/
+{
+	Register_Scheme(SYM_DEFLATE, 0, Deflate_Actor);
+	Register_Scheme(SYM_INFLATE, 0, Inflate_Actor);
+}
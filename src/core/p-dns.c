@@ -104,8 +104,9 @@ pick:
 		if (len == 1) {
 			if (!sock->special.net.host_info || !GET_FLAG(sock->flags, RRF_DONE)) return R_NONE;
 			if (sock->error) {
+				result = sock->error; // (closing clears it)
 				OS_DO_DEVICE(sock, RDC_CLOSE);
-				raise Error_On_Port(RE_READ_ERROR, port, sock->error);
+				raise Error_On_Port(RE_READ_ERROR, port, result);
 			}
 			if (GET_FLAG(sock->modes, RST_REVERSE)) {
 				Val_Init_String(D_OUT, Copy_Bytes(sock->common.data, LEN_BYTES(sock->common.data)));
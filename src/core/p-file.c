@@ -34,6 +34,8 @@
 #define READ_MAX ((REBCNT)(-1))
 #define HL64(v) (v##l + (v##h << 32))
 #define MAX_READ_MASK 0x7FFFFFFF // max size per chunk
+#define READ_STRING_CHUNK 0x100000 // bytes read and decoded at a time
+#define WRITE_BLOCK_CHUNK 0x10000 // bytes formed and written at a time
 
 
 /***********************************************************************
@@ -197,6 +199,123 @@ REBINT Mode_Syms[] = {
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Partial_UTF8_Tail(const REBYTE *bp, REBCNT len)
+/*
+**		How many bytes at the end of the data can't be decoded until
+**		more data comes: the start of a multi-byte UTF-8 character, or
+**		a CR (which may be half of a CR LF).
+**
+***********************************************************************/
+{
+	REBCNT n;
+
+	if (len > 0 && bp[len - 1] == CR) return 1;
+
+	for (n = 1; n <= 3 && n <= len; n++) {
+		REBYTE b = bp[len - n];
+		if (b < 0x80) return 0; // ASCII, so complete
+		if (b >= 0xC0) { // lead byte, with n bytes of the char here
+			REBCNT need = (b >= 0xF0) ? 4 : (b >= 0xE0) ? 3 : 2;
+			return (need > n) ? n : 0;
+		}
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Read_File_String(REBSER *port, REBREQ *file, REBCNT len)
+/*
+**		Read len bytes of UTF-8 text, decoding it a chunk at a time.
+**		Only a chunk's worth of bytes is held at once, instead of all
+**		of them (plus a Unicode-width copy for decoding).
+**
+**		If the read stops short of the end of the file, a partial
+**		character (or a CR) at the end is left to the next READ, so
+**		reading a file in parts decodes the same as reading it whole.
+**
+**		Returns NULL, having read nothing, for a file that starts with
+**		a UTF-16 or UTF-32 byte order mark.
+**
+***********************************************************************/
+{
+	REBSER *buf = Make_Binary(MIN(len, READ_STRING_CHUNK) + 4);
+	REBSER *str = Make_Binary(len);
+	REBFLG at_start = (file->special.file.index == 0);
+	REBCNT carry = 0;	// bytes held over from the last chunk
+	REBCNT hold;
+	REBCNT skip;
+	REBCNT got;
+	REBCNT n;
+
+	for (;;) {
+		n = MIN(len, READ_STRING_CHUNK);
+
+		file->common.data = BIN_SKIP(buf, carry);
+		file->length = n;
+		if (n > 0 && OS_DO_DEVICE(file, RDC_READ) < 0)
+			raise Error_On_Port(RE_READ_ERROR, port, file->error);
+		got = (n > 0) ? file->actual : 0;
+		len -= got;
+		BIN_HEAD(buf)[carry + got] = 0; // a CR at the end looks at this
+
+		skip = 0;
+		if (at_start) {
+			REBINT utf = What_UTF(BIN_HEAD(buf), got);
+			at_start = FALSE;
+			if (utf == 8)
+				skip = 3;
+			else if (utf != 0) {
+				file->special.file.index -= got;
+				SET_FLAG(file->modes, RFM_RESEEK);
+				Free_Series(buf);
+				Free_Series(str);
+				return NULL;
+			}
+		}
+
+		// Nothing is held back at the end of the file
+		hold = (file->special.file.index < file->special.file.size)
+			? Partial_UTF8_Tail(BIN_HEAD(buf), carry + got)
+			: 0;
+
+		// Everything read is a partial character: read on to finish it,
+		// rather than give back an empty string before the end of file.
+		// (Unless nothing was asked for, as with READ/PART of 0.)
+		if (n > 0 && len == 0 && got == n && hold == carry + got) {
+			carry = hold;
+			len = 1;
+			continue;
+		}
+
+		if (len == 0 || got < n) {
+			Decode_UTF8_Onto(
+				str, BIN_SKIP(buf, skip), carry + got - hold - skip, TRUE
+			);
+
+			if (hold) {
+				file->special.file.index -= hold;
+				SET_FLAG(file->modes, RFM_RESEEK);
+			}
+			break;
+		}
+
+		Decode_UTF8_Onto(
+			str, BIN_SKIP(buf, skip), carry + got - hold - skip, TRUE
+		);
+		memmove(BIN_HEAD(buf), BIN_SKIP(buf, carry + got - hold), hold);
+		carry = hold;
+	}
+
+	Free_Series(buf);
+	return str;
+}
+
+
 /***********************************************************************
 **
 */	static void Read_File_Port(REBVAL *out, REBSER *port, REBREQ *file, REBVAL *path, REBCNT args, REBCNT len)
@@ -207,6 +326,16 @@ REBINT Mode_Syms[] = {
 {
 	REBSER *ser;
 
+	// Text is decoded as it is read (unless it is UTF-16 or UTF-32)
+	if (args & (AM_READ_STRING | AM_READ_LINES)) {
+		ser = Read_File_String(port, file, len);
+		if (ser) {
+			Val_Init_String(out, ser);
+			if (args & AM_READ_LINES) Val_Init_Block(out, Split_Lines(out));
+			return;
+		}
+	}
+
 	// Allocate read result buffer:
 	ser = Make_Binary(len);
 	Val_Init_Binary(out, ser); //??? what if already set?
@@ -220,7 +349,6 @@ REBINT Mode_Syms[] = {
 	STR_TERM(ser);
 
 	// Convert to string or block of strings.
-	// NOTE: This code is incorrect for files read in chunks!!!
 	if (args & (AM_READ_STRING | AM_READ_LINES)) {
 		REBSER *nser = Decode_UTF_String(BIN_HEAD(ser), file->actual, -1);
 		if (nser == NULL) raise Error_0(RE_BAD_DECODE);
@@ -231,6 +359,102 @@ REBINT Mode_Syms[] = {
 }
 
 
+/***********************************************************************
+**
+*/	static REBFLG Write_File_Piece(REBREQ *file, REBYTE *data, REBCNT len, REBFLG first)
+/*
+**		Write one of the pieces of data that a single WRITE is split
+**		into.  A port opened with /SEEK (or that was CLEARed) seeks to
+**		its index before every write, so for the pieces after the first
+**		the index is moved past what was already written.  The caller
+**		puts it back afterwards (see Write_File_Block).
+**
+**		Returns FALSE if there was an error (see file->error).
+**
+***********************************************************************/
+{
+	if (!first && (file->modes & ((1 << RFM_SEEK) | (1 << RFM_TRUNCATE))))
+		file->special.file.index += file->actual;
+
+	file->common.data = data;
+	file->length = len;
+	return OS_DO_DEVICE(file, RDC_WRITE) >= 0;
+}
+
+
+/***********************************************************************
+**
+*/	static void Write_File_Block(REBREQ *file, REBVAL *data, REBCNT args)
+/*
+**		Form the values of a block (one per line for /LINES) and write
+**		them as UTF-8, a piece at a time.  Only about a piece's worth
+**		of the formed text and of its encoding is held at once, so a
+**		block of any size can be written without forming all of it.
+**
+**		The spacing is the same as FORM's (see Form_Block_Series).
+**
+***********************************************************************/
+{
+	REBSER *blk = VAL_SERIES(data);
+	REBCNT index = VAL_INDEX(data);
+	REBCNT len = VAL_LEN(data);
+	REBSER *bin = Make_Binary(WRITE_BLOCK_CHUNK);
+	REBFLG first = TRUE;
+	i64 start = 0;
+	REBCNT n;
+	REB_MOLD mo;
+
+	CLEARS(&mo);
+	Reset_Mold(&mo);
+	if (args & AM_WRITE_LINES) mo.opts = 1 << MOPT_LINES;
+
+	for (n = 0; n < len;) {
+		Mold_Value(&mo, BLK_SKIP(blk, index + n), FALSE);
+		n++;
+		if (args & AM_WRITE_LINES)
+			Append_Codepoint_Raw(mo.series, LF);
+		else if (n < len && mo.series->tail && *UNI_LAST(mo.series) != LF)
+			Append_Codepoint_Raw(mo.series, ' ');
+
+		// Write out all but the last char (which is looked at above to
+		// know if a space is needed), unless the block is finished.
+		if (n == len || SERIES_TAIL(mo.series) >= WRITE_BLOCK_CHUNK) {
+			REBCNT keep = (n == len) ? 0 : 1;
+			REBCNT done = 0;
+			REBCNT size;
+			REBCNT count;
+
+			while (done < SERIES_TAIL(mo.series) - keep) {
+				count = SERIES_TAIL(mo.series) - keep - done;
+				size = Encode_UTF8(
+					BIN_HEAD(bin),
+					WRITE_BLOCK_CHUNK,
+					UNI_SKIP(mo.series, done),
+					&count,
+					OPT_ENC_UNISRC | OPT_ENC_CRLF_MAYBE
+				);
+				done += count;
+				if (!Write_File_Piece(file, BIN_HEAD(bin), size, first))
+					goto finished;
+				if (first) start = file->special.file.index;
+				first = FALSE;
+			}
+
+			if (keep) *UNI_HEAD(mo.series) = *UNI_LAST(mo.series);
+			SERIES_TAIL(mo.series) = keep;
+		}
+	}
+
+finished:
+	// A string or binary WRITE leaves the index where the write began
+	// (where the device seeked to), so put it back there, whatever the
+	// pieces moved it by.
+	if (!first) file->special.file.index = start;
+
+	Free_Series(bin);
+}
+
+
 /***********************************************************************
 **
 */	static void Write_File_Port(REBREQ *file, REBVAL *data, REBCNT len, REBCNT args)
@@ -240,18 +464,8 @@ REBINT Mode_Syms[] = {
 	REBSER *ser;
 
 	if (IS_BLOCK(data)) {
-		// Form the values of the block
-		// !! Could be made more efficient if we broke the FORM
-		// into 32K chunks for writing.
-		REB_MOLD mo;
-		CLEARS(&mo);
-		Reset_Mold(&mo);
-		if (args & AM_WRITE_LINES) {
-			mo.opts = 1 << MOPT_LINES;
-		}
-		Mold_Value(&mo, data, 0);
-		Val_Init_String(data, mo.series); // fall into next section
-		len = SERIES_TAIL(mo.series);
+		Write_File_Block(file, data, args);
+		return;
 	}
 
 	// Auto convert string to UTF-8
@@ -102,6 +102,54 @@ enum Transport_Types {
 	OS_FREE(nsock); // allocated by dev_net.c (MT issues?)
 }
 
+/***********************************************************************
+**
+*/	static u32 Spec_Net_Size(REBSER *port, REBVAL *spec, REBCNT field)
+/*
+**		Get a byte count setting from the port spec (zero if none).
+**
+***********************************************************************/
+{
+	REBVAL *val = Obj_Value(spec, field);
+
+	if (IS_NONE(val)) return 0;
+	if (!IS_INTEGER(val) || VAL_INT64(val) <= 0 || VAL_INT64(val) > MAX_I32)
+		raise Error_On_Port(RE_INVALID_SPEC, port, -10);
+	return VAL_INT32(val);
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Make_Gather_Pieces(REBVAL *block, REBCNT *len)
+/*
+**		Make the REBIOV array for a gathered write of a block of
+**		binaries (see RST_GATHER), and give back their total length.
+**
+**		The array is a binary so the GC will take care of it, but the
+**		caller must keep it (and the block) safe until the write is done.
+**
+***********************************************************************/
+{
+	REBCNT count = VAL_LEN(block);
+	REBSER *ser = Make_Binary(count * sizeof(REBIOV));
+	REBIOV *piece = cast(REBIOV*, BIN_HEAD(ser));
+	REBVAL *val;
+
+	*len = 0;
+	for (val = VAL_BLK_DATA(block); NOT_END(val); val++, piece++) {
+		if (!IS_BINARY(val)) raise Error_Invalid_Arg(val);
+		piece->data = VAL_BIN_DATA(val);
+		piece->length = VAL_LEN(val);
+		*len += piece->length;
+	}
+
+	SERIES_TAIL(ser) = count * sizeof(REBIOV);
+	TERM_SEQUENCE(ser);
+	return ser;
+}
+
+
 /***********************************************************************
 **
 */	static REB_R Transport_Actor(struct Reb_Call *call_, REBSER *port, REBCNT action, enum Transport_Types proto)
@@ -145,6 +193,16 @@ enum Transport_Types {
 			arg = Obj_Value(spec, STD_PORT_SPEC_NET_HOST);
 			val = Obj_Value(spec, STD_PORT_SPEC_NET_PORT_ID);
 
+			sock->special.net.transfer = Spec_Net_Size(
+				port, spec, STD_PORT_SPEC_NET_TRANSFER_SIZE
+			);
+			sock->special.net.send_buffer = Spec_Net_Size(
+				port, spec, STD_PORT_SPEC_NET_SEND_BUFFER
+			);
+			sock->special.net.recv_buffer = Spec_Net_Size(
+				port, spec, STD_PORT_SPEC_NET_RECEIVE_BUFFER
+			);
+
 			if (OS_DO_DEVICE(sock, RDC_OPEN))
 				raise Error_On_Port(RE_CANNOT_OPEN, port, -12);
 			SET_OPEN(sock);
@@ -216,14 +274,16 @@ enum Transport_Types {
 			raise Error_On_Port(RE_NOT_CONNECTED, port, -15);
 		}
 
-		// Setup the read buffer (allocate a buffer if needed):
+		// Setup the read buffer (allocate a buffer if needed), with
+		// room for at least one full transfer:
+		len = MAX(NET_BUF_SIZE, sock->special.net.transfer);
 		arg = OFV(port, STD_PORT_DATA);
 		if (!IS_STRING(arg) && !IS_BINARY(arg)) {
-			Val_Init_Binary(arg, Make_Binary(NET_BUF_SIZE));
+			Val_Init_Binary(arg, Make_Binary(len));
 		}
 		ser = VAL_SERIES(arg);
 		sock->length = SERIES_AVAIL(ser); // space available
-		if (sock->length < NET_BUF_SIZE/2) Extend_Series(ser, NET_BUF_SIZE);
+		if (sock->length < len/2) Extend_Series(ser, len);
 		sock->length = SERIES_AVAIL(ser);
 		sock->common.data = STR_TAIL(ser); // write at tail
 		//if (SERIES_TAIL(ser) == 0)
@@ -243,18 +303,36 @@ enum Transport_Types {
 			&& !GET_FLAG(sock->state, RSM_CONNECT))
 			raise Error_On_Port(RE_NOT_CONNECTED, port, -15);
 
-		// Determine length. Clip /PART to size of string if needed.
+		// A block of binaries is sent as if it were one binary, but
+		// without joining them (the OS gathers from each in turn).
+		// /PART counts bytes in either case.
 		spec = D_ARG(2);
-		len = VAL_LEN(spec);
+		if (IS_BLOCK(spec)) {
+			ser = Make_Gather_Pieces(spec, &len);
+			SET_FLAG(sock->modes, RST_GATHER);
+
+			// Keep the block and the pieces GC safe:
+			val = OFV(port, STD_PORT_DATA);
+			Val_Init_Block(val, Make_Array(2));
+			Append_Value(VAL_SERIES(val), spec);
+			Val_Init_Binary(Alloc_Tail_Array(VAL_SERIES(val)), ser);
+		}
+		else {
+			len = VAL_LEN(spec);
+			ser = NULL;
+			CLR_FLAG(sock->modes, RST_GATHER);
+			*OFV(port, STD_PORT_DATA) = *spec;	// keep it GC safe
+		}
+
+		// Clip /PART to size of data if needed.
 		if (refs & AM_WRITE_PART) {
 			REBCNT n = Int32s(D_ARG(ARG_WRITE_LIMIT), 0);
 			if (n <= len) len = n;
 		}
 
 		// Setup the write:
-		*OFV(port, STD_PORT_DATA) = *spec;	// keep it GC safe
 		sock->length = len;
-		sock->common.data = VAL_BIN_DATA(spec);
+		sock->common.data = ser ? BIN_HEAD(ser) : VAL_BIN_DATA(spec);
 		sock->actual = 0;
 
 		//Print("(write length %d)", len);
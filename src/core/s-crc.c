@@ -41,6 +41,16 @@
 
 static REBCNT *CRC_Table;
 
+// Constants for Hash_String() and Hash_Word() (from xxHash64):
+#define HASH_PRIME1 U64_C(0x9E3779B185EBCA87)
+#define HASH_PRIME2 U64_C(0xC2B2AE3D27D4EB4F)
+#define HASH_PRIME3 U64_C(0x165667B19E3779F9)
+#define HASH_PRIME4 U64_C(0x85EBCA77C2B2AE63)
+#define HASH_PRIME5 U64_C(0x27D4EB2F165667C5)
+#define HASH_SEED HASH_PRIME5
+#define HASH_HIGH_BITS U64_C(0x8080808080808080)
+#define HASH_ROTL(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
 /***********************************************************************
 **
 */	static REBCNT Generate_CRC(REBYTE ch, REBCNT poly, REBCNT accum)
@@ -138,10 +148,12 @@ static REBCNT *CRC_Table;
 
 /***********************************************************************
 **
-*/	REBINT Hash_String(const REBYTE *str, REBCNT len)
+*/	REBINT Hash_String_CRC(const REBYTE *str, REBCNT len)
 /*
-**		Return a case insensitive hash value for the string.  The
-**		string does not have to be zero terminated and UTF8 is ok.
+**		Return a case insensitive hash value for the string, using
+**		the CRC table a byte at a time. This is the historical
+**		result of CHECKSUM/HASH, which scripts may have saved, so
+**		it must not change. In-memory hashing uses Hash_String().
 **
 ***********************************************************************/
 {
@@ -163,38 +175,154 @@ static REBCNT *CRC_Table;
 
 /***********************************************************************
 **
-*/	REBINT Hash_Word(const REBYTE *str, REBCNT len)
+*/	static REBU64 Fold_Ascii_64(REBU64 chunk)
 /*
-**		Return a case insensitive hash value for the string.
+**		Lowercase 8 ASCII bytes at once. Every byte must be < 0x80,
+**		so the adds below cannot carry from one byte into the next.
+**		The high bit of a byte ends up set only for 'A' to 'Z', and
+**		is moved down to 0x20 to be or'd in.
 **
 ***********************************************************************/
 {
-	REBINT hash =
-		cast(REBINT, len) + cast(REBINT, cast(REBYTE, LO_CASE(*str)));
+	REBU64 upper =
+		(chunk + U64_C(0x3F3F3F3F3F3F3F3F))		// >= 'A'
+		& ~(chunk + U64_C(0x2525252525252525))	// not > 'Z'
+		& HASH_HIGH_BITS;
 
-	for (; len > 0; str++, len--) {
-		REBUNI n = *str;
+	return chunk | (upper >> 2);
+}
 
-		if (n >= 0x80) {
-			str = Back_Scan_UTF8_Char(&n, str, &len);
-			assert(str); // UTF8 should have already been verified good
-		}
 
-		// Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-		// !!! Is this actually faster?
-		if (n < UNICODE_CASES)
-			n = cast(REBYTE, LO_CASE(n));
+/***********************************************************************
+**
+*/	static REBU64 Hash_Chunk(REBU64 hash, REBU64 chunk)
+/*
+**		Mix 8 bytes of input into the hash (xxHash64 style round).
+**
+***********************************************************************/
+{
+	chunk *= HASH_PRIME2;
+	chunk = HASH_ROTL(chunk, 31) * HASH_PRIME1;
+	hash ^= chunk;
+	return HASH_ROTL(hash, 27) * HASH_PRIME1 + HASH_PRIME4;
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Hash_Finish(REBU64 hash, REBCNT len)
+/*
+**		Final avalanche, so that all the bits of the result depend
+**		on all of the input (callers mask off low bits as well as
+**		take slices). Result is 31 bits, never negative.
+**
+***********************************************************************/
+{
+	hash ^= len * HASH_PRIME5;
+	hash ^= hash >> 33;
+	hash *= HASH_PRIME2;
+	hash ^= hash >> 29;
+	hash *= HASH_PRIME3;
+	hash ^= hash >> 32;
+
+	return cast(REBINT, hash & 0x7FFFFFFF);
+}
+
+
+/***********************************************************************
+**
+*/	REBINT Hash_String(const REBYTE *str, REBCNT len)
+/*
+**		Return a case insensitive hash value for the string.  The
+**		string does not have to be zero terminated and UTF8 is ok.
+**
+**		Hashes 8 bytes per step. Runs of ASCII are case folded a
+**		chunk at a time, other bytes go through LO_CASE.
+**
+***********************************************************************/
+{
+	REBU64 hash = HASH_SEED;
+	REBU64 chunk;
+	REBYTE buf[8];
+	REBCNT total = len;
+	REBCNT n;
+
+	for (; len >= 8; str += 8, len -= 8) {
+		memcpy(&chunk, str, 8);
+		if (chunk & HASH_HIGH_BITS) {
+			for (n = 0; n < 8; n++) buf[n] = cast(REBYTE, LO_CASE(str[n]));
+			memcpy(&chunk, buf, 8);
+		}
 		else
-			n = cast(REBYTE, n);
+			chunk = Fold_Ascii_64(chunk);
+		hash = Hash_Chunk(hash, chunk);
+	}
 
-		n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
+	CLEAR(buf, 8);
+	for (n = 0; n < len; n++) buf[n] = cast(REBYTE, LO_CASE(str[n]));
+	memcpy(&chunk, buf, 8);
+	hash = Hash_Chunk(hash, chunk);
 
-		// Left shift math must use unsigned to avoid undefined behavior
-		// http://stackoverflow.com/q/3784996/211160
-		hash = cast(REBINT, MASK_CRC(cast(REBCNT, hash) << 8) ^ CRC_Table[n]);
+	return Hash_Finish(hash, total);
+}
+
+
+/***********************************************************************
+**
+*/	REBINT Hash_Word(const REBYTE *str, REBCNT len)
+/*
+**		Return a case insensitive hash value for the UTF8 string.
+**
+**		The hash is taken over the low byte of each lowercased code
+**		point, so spellings that Compare_UTF8() finds equal hash the
+**		same even if their UTF8 lengths differ. Eight ASCII bytes at
+**		a time are folded in directly when they line up with the
+**		chunk being built, which is nearly always for word names.
+**
+***********************************************************************/
+{
+	REBU64 hash = HASH_SEED;
+	REBU64 chunk;
+	REBYTE buf[8];
+	REBCNT fill = 0;
+	REBCNT count = 0;
+	REBUNI c;
+
+	while (len > 0) {
+		if (fill == 0 && len >= 8) {
+			memcpy(&chunk, str, 8);
+			if (!(chunk & HASH_HIGH_BITS)) {
+				hash = Hash_Chunk(hash, Fold_Ascii_64(chunk));
+				str += 8;
+				len -= 8;
+				count += 8;
+				continue;
+			}
+		}
+
+		c = *str;
+		if (c >= 0x80) {
+			str = Back_Scan_UTF8_Char(&c, str, &len);
+			assert(str); // UTF8 should have already been verified good
+		}
+		str++;
+		len--;
+
+		buf[fill++] = cast(REBYTE, c < UNICODE_CASES ? LO_CASE(c) : c);
+		count++;
+
+		if (fill == 8) {
+			memcpy(&chunk, buf, 8);
+			hash = Hash_Chunk(hash, chunk);
+			fill = 0;
+		}
 	}
 
-	return hash;
+	CLEAR(buf + fill, 8 - fill);
+	memcpy(&chunk, buf, 8);
+	hash = Hash_Chunk(hash, chunk);
+
+	return Hash_Finish(hash, count);
 }
 
 
@@ -409,7 +537,16 @@ static void Make_CRC32_Table(void) {
 	}
 }
 
-REBCNT Update_CRC32(u32 crc, REBYTE *buf, int len) {
+
+/***********************************************************************
+**
+*/	REBCNT Update_CRC32(u32 crc, REBYTE *buf, int len)
+/*
+**		Continue a CRC32 of earlier data with more of it (start with
+**		a crc of 0).
+**
+***********************************************************************/
+{
 	u32 c = ~crc;
 	int n;
 
@@ -565,26 +565,10 @@ cp_same:
 **
 ***********************************************************************/
 {
-	REBSER *ser = BUF_UTF8;	// buffer is Unicode width
-
 	if (len < 0) len = LEN_BYTES(src);
 
-	Resize_Series(ser, len+1); // needs at most this much
-
-	len = Decode_UTF8(UNI_HEAD(ser), src, len, FALSE);
-
-	if (len < 0) {
-		len = -len;
-		if (!dst) dst = Make_Binary(len);
-		if (BYTE_SIZE(dst)) {
-			Append_Uni_Bytes(dst, UNI_HEAD(ser), len);
-			return dst;
-		}
-	} else {
-		if (!dst) dst = Make_Unicode(len);
-	}
-
-	Append_Uni_Uni(dst, UNI_HEAD(ser), len);
+	if (!dst) dst = Make_Binary(len);
+	Decode_UTF8_Onto(dst, src, len, FALSE);
 
 	return dst;
 }
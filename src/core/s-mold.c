@@ -31,6 +31,14 @@
 #include "sys-core.h"
 #include <float.h>
 
+// Strings are checked for chars that need escaping 16 bytes at a time
+// where SSE2 is known to be present (all x86-64 targets), elsewhere a
+// byte at a time.
+#if defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define MOLD_SSE2
+#endif
+
 #define	MAX_QUOTED_STR	50	// max length of "string" before going to { }
 
 //typedef REBSER *(*MOLD_FUNC)(REBVAL *, REBSER *, REBCNT);
@@ -285,6 +293,63 @@ typedef struct REB_Str_Flags {
 } REB_STRF;
 
 
+// Printable ASCII that a molded string holds as-is, in either form
+#define IS_PLAIN_BYTE(c) \
+	((c) >= ' ' && (c) < 0x7f \
+		&& (c) != '"' && (c) != '^' && (c) != '{' && (c) != '}')
+
+#ifdef MOLD_SSE2
+static REBCNT Plain_Mask_16(const REBYTE *bp)
+{
+	// Signed compare: bytes 0x80 and over count as below the space
+	__m128i v = _mm_loadu_si128(cast(const __m128i*, bp));
+	__m128i m = _mm_cmplt_epi8(v, _mm_set1_epi8(' '));
+
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('^')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('{')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('}')));
+	return _mm_movemask_epi8(m); // zero if all 16 are plain
+}
+#endif
+
+static REBCNT Plain_Byte_Run(const REBYTE *bp, REBCNT len)
+{
+	// Count the plain bytes at bp
+	REBCNT n = 0;
+
+#ifdef MOLD_SSE2
+	while (n + 16 <= len && Plain_Mask_16(bp + n) == 0) n += 16;
+#endif
+	while (n < len && IS_PLAIN_BYTE(bp[n])) n++;
+	return n;
+}
+
+static REBCNT Emit_Plain_Bytes(REBUNI *dp, const REBYTE *bp, REBCNT len)
+{
+	// Copy the plain bytes at bp as chars, returning how many there were
+	REBCNT n = 0;
+
+#ifdef MOLD_SSE2
+	__m128i zero = _mm_setzero_si128();
+	__m128i v;
+
+	while (n + 16 <= len && Plain_Mask_16(bp + n) == 0) {
+		v = _mm_loadu_si128(cast(const __m128i*, bp + n));
+		_mm_storeu_si128(
+			cast(__m128i*, dp + n), _mm_unpacklo_epi8(v, zero)
+		);
+		_mm_storeu_si128(
+			cast(__m128i*, dp + n + 8), _mm_unpackhi_epi8(v, zero)
+		);
+		n += 16;
+	}
+#endif
+	for (; n < len && IS_PLAIN_BYTE(bp[n]); n++) dp[n] = bp[n];
+	return n;
+}
+
 static void Sniff_String(REBSER *ser, REBCNT idx, REB_STRF *sf)
 {
 	// Scan to find out what special chars the string contains?
@@ -294,6 +359,10 @@ static void Sniff_String(REBSER *ser, REBCNT idx, REB_STRF *sf)
 	REBCNT n;
 
 	for (n = idx; n < SERIES_TAIL(ser); n++) {
+		if (BYTE_SIZE(ser)) {
+			n += Plain_Byte_Run(bp + n, SERIES_TAIL(ser) - n);
+			if (n == SERIES_TAIL(ser)) break;
+		}
 		c = (BYTE_SIZE(ser)) ? (REBUNI)(bp[n]) : up[n];
 		switch (c) {
 		case '{':
@@ -372,6 +441,7 @@ static void Mold_String_Series(const REBVAL *value, REB_MOLD *mold)
 	REBUNI *dp;
 	REBOOL uni = !BYTE_SIZE(ser);
 	REBCNT n;
+	REBCNT run;
 	REBUNI c;
 
 	REB_STRF sf;
@@ -399,6 +469,12 @@ static void Mold_String_Series(const REBVAL *value, REB_MOLD *mold)
 		*dp++ = '"';
 
 		for (n = idx; n < VAL_TAIL(value); n++) {
+			if (!uni) {
+				run = Emit_Plain_Bytes(dp, bp + n, VAL_TAIL(value) - n);
+				dp += run;
+				n += run;
+				if (n == VAL_TAIL(value)) break;
+			}
 			c = uni ? up[n] : cast(REBUNI, bp[n]);
 			dp = Emit_Uni_Char(dp, c, (REBOOL)GET_MOPT(mold, MOPT_ANSI_ONLY)); // parened
 		}
@@ -416,6 +492,12 @@ static void Mold_String_Series(const REBVAL *value, REB_MOLD *mold)
 	*dp++ = '{';
 
 	for (n = idx; n < VAL_TAIL(value); n++) {
+		if (!uni) {
+			run = Emit_Plain_Bytes(dp, bp + n, VAL_TAIL(value) - n);
+			dp += run;
+			n += run;
+			if (n == VAL_TAIL(value)) break;
+		}
 
 		c = uni ? up[n] : cast(REBUNI, bp[n]);
 		switch (c) {
@@ -1292,6 +1374,12 @@ append:
 ***********************************************************************/
 {
 	REB_MOLD mo;
+
+	// Forming a string is just a copy of it (see Mold_Value), which can
+	// be made without widening it into the mold buffer and back.
+	if (ANY_STR(value) && !IS_TAG(value))
+		return Copy_String(VAL_SERIES(value), VAL_INDEX(value), VAL_LEN(value));
+
 	CLEARS(&mo);
 	mo.opts = opts;
 	Reset_Mold(&mo);
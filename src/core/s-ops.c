@@ -39,6 +39,15 @@
 **
 ***********************************************************************/
 {
+	REBU64 word;
+
+	// Eight at a time, as this runs over all of a large string before
+	// it is written out
+	for (; len >= 8; len -= 8, bp += 8) {
+		memcpy(&word, bp, 8);
+		if (word & U64_C(0x8080808080808080)) return FALSE;
+	}
+
 	for (; len > 0; len--, bp++)
 		if (*bp >= 0x80) return FALSE;
 
@@ -901,6 +901,82 @@ ConversionResult ConvertUTF8toUTF32 (
 }
 
 
+// Eight bytes at a time: are any of them non-ASCII, or a CR?
+#define HIGH_BITS_8 U64_C(0x8080808080808080)
+#define HAS_CR_8(w) \
+	((((w) ^ U64_C(0x0D0D0D0D0D0D0D0D)) - U64_C(0x0101010101010101)) \
+		& ~((w) ^ U64_C(0x0D0D0D0D0D0D0D0D)) & HIGH_BITS_8)
+
+/***********************************************************************
+**
+*/	void Decode_UTF8_Onto(REBSER *dst, const REBYTE *src, REBCNT len, REBFLG ccr)
+/*
+**		Decode UTF-8 onto the tail of a string, straight into its own
+**		data rather than through a Unicode-width buffer and a copy.
+**		A byte-sized string stays that way unless a char over 0xFF
+**		turns up, and is widened only then.  Runs of ASCII are copied
+**		eight bytes at a time.
+**
+**		ccr: convert CRLF/CR to LF
+**
+***********************************************************************/
+{
+	REBCNT tail = SERIES_TAIL(dst);
+	REBCNT n = tail; // where the next char goes
+	REBOOL wide = !BYTE_SIZE(dst);
+	REBUNI ch = 0;
+	REBU64 word;
+	REBCNT i;
+
+	// A char takes at least one byte.  (EXPAND_SERIES_TAIL would want
+	// one more than the room needed, so a series made for len expands.)
+	if (SERIES_AVAIL(dst) >= len) SERIES_TAIL(dst) += len;
+	else Expand_Series(dst, AT_TAIL, len);
+
+	for (; len > 0; len--, src++) {
+		while (len >= 8) {
+			memcpy(&word, src, 8);
+			if ((word & HIGH_BITS_8) || (ccr && HAS_CR_8(word))) break;
+			if (wide)
+				for (i = 0; i < 8; i++) UNI_HEAD(dst)[n + i] = src[i];
+			else
+				memcpy(BIN_SKIP(dst, n), src, 8);
+			n += 8;
+			src += 8;
+			len -= 8;
+		}
+		if (len == 0) break;
+
+		if ((ch = *src) >= 0x80) {
+			if (!(src = Back_Scan_UTF8_Char(&ch, src, &len))) {
+				SERIES_TAIL(dst) = tail;
+				TERM_SEQUENCE(dst);
+				raise Error_0(RE_BAD_DECODE);
+			}
+			if (ch > 0xff && !wide) {
+				SERIES_TAIL(dst) = n;
+				TERM_SEQUENCE(dst);
+				Widen_String(dst, TRUE);
+				Expand_Series(dst, AT_TAIL, len);
+				wide = TRUE;
+			}
+		}
+		else if (ch == CR && ccr) {
+			if (len > 1 && src[1] == LF) continue;
+			ch = LF;
+		}
+
+		if (wide)
+			UNI_HEAD(dst)[n++] = ch;
+		else
+			BIN_HEAD(dst)[n++] = cast(REBYTE, ch);
+	}
+
+	SERIES_TAIL(dst) = n;
+	TERM_SEQUENCE(dst);
+}
+
+
 /***********************************************************************
 **
 */	int Decode_UTF16(REBUNI *dst, REBYTE *src, REBCNT len, REBFLG lee, REBFLG ccr)
@@ -983,9 +1059,12 @@ ConversionResult ConvertUTF8toUTF32 (
 	}
 
 	if (utf == 0 || utf == 8) {
-		size = Decode_UTF8((REBUNI*)Reset_Buffer(ser, len), bp, len, TRUE);
+		dst = Make_Binary(len);
+		Decode_UTF8_Onto(dst, bp, len, TRUE);
+		return dst;
 	}
-	else if (utf == -16 || utf == 16) {
+
+	if (utf == -16 || utf == 16) {
 		size = Decode_UTF16((REBUNI*)Reset_Buffer(ser, len/2 + 1), bp, len, utf < 0, TRUE);
 	}
 	else {
@@ -29,31 +29,54 @@
 /*
 	A map is a SERIES that can also include a hash table for faster lookup.
 
-	The hashing method used here is the same as that used for the
-	REBOL symbol table, with the exception that this method must
-	also store the value of the symbol (not just its word).
-
-	The structure of the series header for a map is the	same as other
-	series, except that the opt series field is	a pointer to a REBCNT
-	series, the hash table.
-
-	The hash table is an array of REBCNT integers that are index values
-	into the map series. NOTE: They are one-based to avoid 0 which is an
-	empty slot.
+	Each value in the map consists of a key followed by its value.
+	The series/tail / 2 is the number of values stored. Entries are
+	never removed (setting a key to NONE leaves it in place), which
+	lets the hash table get by without tombstones.
+
+	The structure of the series header for a map is the same as other
+	series, except that the extra series field is a pointer to a byte
+	series, the hash index. It is laid out as:
+
+		control bytes	- one per slot, 0 for empty, else 0x80 | 7 hash bits
+		mirror bytes	- copy of the first MAP_GROUP control bytes
+		slots			- one REBMSL per slot (entry index and full hash)
+
+	The hash-series/tail is the slot count, a power of two. Lookups
+	are open addressing over groups of MAP_GROUP control bytes, which
+	are compared against the 7 bit tag all at once as a single 64 bit
+	word. Only slots whose tag matches go on to compare the stored
+	hash, and only then is the key in the map series itself touched.
+	The mirror bytes let a group that runs off the end be loaded
+	without wrapping. Growing the table reuses the stored hashes, so
+	keys are never rehashed.
+
+	The entry indexes are one-based to avoid 0.
+
+	SET operations (e.g. UNION) still use Find_Key() and the prime
+	sized REBCNT tables from Make_Hash_Sequence(), or Find_Key_Linear()
+	when the blocks are small.
+*/
 
-	Each value in the map consists of a word followed by its value.
+#include "sys-core.h"
 
-	These functions are also used hashing SET operations (e.g. UNION).
+#define MIN_DICT 8 // size to switch to hashing
 
-	The series/tail / 2 is the number of values stored.
+#define MAP_GROUP 8 // control bytes probed at once
+#define MAP_LIMIT(n) ((n) - (n) / 8) // max entries for a slot count
+#define MAP_MAX_SLOTS (1 << 27)
 
-	The hash-series/tail is a prime number that is use for computing
-	slots in the hash table.
-*/
+#define MAP_LSB  U64_C(0x0101010101010101)
+#define MAP_LOW7 U64_C(0x7F7F7F7F7F7F7F7F)
+#define MAP_HIGH U64_C(0x8080808080808080)
 
-#include "sys-core.h"
+typedef struct Reb_Map_Slot {
+	REBCNT index;	// one-based entry index in the map series
+	REBCNT hash;	// full hash of the key
+} REBMSL;
 
-#define MIN_DICT 8 // size to switch to hashing
+#define MAP_CONTROL(h) BIN_DATA(h)
+#define MAP_SLOTS(h) cast(REBMSL*, BIN_SKIP((h), SERIES_TAIL(h) + MAP_GROUP))
 
 
 /***********************************************************************
@@ -68,6 +91,192 @@
 }
 
 
+/***********************************************************************
+**
+*/	static REBSER *Make_Map_Index(REBCNT count)
+/*
+**		Makes an empty hash index that can hold count entries
+**		before it must grow.
+**
+***********************************************************************/
+{
+	REBCNT slots = MAP_GROUP;
+	REBSER *hser;
+
+	while (MAP_LIMIT(slots) < count) {
+		if (slots >= MAP_MAX_SLOTS) {
+			REBVAL temp;
+			SET_INTEGER(&temp, count);
+			raise Error_1(RE_SIZE_LIMIT, &temp);
+		}
+		slots <<= 1;
+	}
+
+	hser = Make_Series(slots + MAP_GROUP + slots * sizeof(REBMSL), 1, MKS_NONE);
+	LABEL_SERIES(hser, "make map index");
+	CLEAR(MAP_CONTROL(hser), slots + MAP_GROUP);
+	hser->tail = slots;
+
+	return hser;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Hash_Map_Key(const REBVAL *key)
+/*
+**		Hash_Value() of words is just the canon symbol number, so
+**		the bits are mixed to spread them over both the slot and
+**		the control byte tag.
+**
+***********************************************************************/
+{
+	REBCNT hash = (REBCNT)Hash_Value(key, 0x80000000);
+
+	if (!hash) raise Error_Has_Bad_Type(key);
+
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Same_Map_Key(const REBVAL *key, const REBVAL *val)
+/*
+**		Same key comparison as Find_Key() when not cased.
+**
+***********************************************************************/
+{
+	if (ANY_WORD(key))
+		return ANY_WORD(val) && VAL_WORD_CANON(key) == VAL_WORD_CANON(val);
+
+	if (VAL_TYPE(val) != VAL_TYPE(key)) return FALSE;
+
+	if (ANY_BINSTR(key))
+		return 0 == Compare_String_Vals(key, val, (REBOOL)!IS_BINARY(key));
+
+	return 0 == Cmp_Value(key, val, TRUE);
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Map_Slot(REBSER *series, REBSER *hser, const REBVAL *key, REBCNT hash)
+/*
+**		Returns the slot holding the key, or the empty slot where
+**		it belongs. A null key skips the compare (used when the
+**		keys are known to be distinct, as on growth).
+**
+**		The table is never full (see MAP_LIMIT), so there is
+**		always an empty slot to stop on.
+**
+***********************************************************************/
+{
+	REBYTE *ctrl = MAP_CONTROL(hser);
+	REBMSL *slots = MAP_SLOTS(hser);
+	REBCNT mask = SERIES_TAIL(hser) - 1;
+	REBCNT pos = (hash >> 7) & mask;
+	REBCNT step = 0;
+	REBU64 tags = MAP_LSB * (0x80 | (hash & 0x7F));
+	REBU64 group;
+	REBU64 bits;
+	REBYTE hits[MAP_GROUP];
+	REBCNT slot;
+	REBCNT n;
+
+	for (;;) {
+		memcpy(&group, ctrl + pos, MAP_GROUP);
+
+		// A control byte equal to the tag becomes zero here, and
+		// each zero byte then gets only its high bit set:
+		bits = group ^ tags;
+		bits = ~(((bits & MAP_LOW7) + MAP_LOW7) | bits | MAP_LOW7);
+		if (bits && key) {
+			memcpy(hits, &bits, MAP_GROUP); // byte order neutral
+			for (n = 0; n < MAP_GROUP; n++) {
+				if (!hits[n]) continue;
+				slot = (pos + n) & mask;
+				if (
+					slots[slot].hash == hash
+					&& Same_Map_Key(key, BLK_SKIP(series, (slots[slot].index - 1) * 2))
+				) return slot;
+			}
+		}
+
+		// Empty control bytes are the ones without the high bit:
+		bits = ~group & MAP_HIGH;
+		if (bits) {
+			memcpy(hits, &bits, MAP_GROUP);
+			for (n = 0; !hits[n]; n++);
+			return (pos + n) & mask;
+		}
+
+		step += MAP_GROUP;
+		pos = (pos + step) & mask;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Set_Map_Slot(REBSER *hser, REBCNT slot, REBCNT index, REBCNT hash)
+/*
+***********************************************************************/
+{
+	REBYTE *ctrl = MAP_CONTROL(hser);
+	REBYTE tag = (REBYTE)(0x80 | (hash & 0x7F));
+	REBMSL *slots = MAP_SLOTS(hser);
+
+	ctrl[slot] = tag;
+	if (slot < MAP_GROUP) ctrl[SERIES_TAIL(hser) + slot] = tag;
+
+	slots[slot].index = index;
+	slots[slot].hash = hash;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Grow_Map_Index(REBSER *series, REBCNT count)
+/*
+**		Replace the hash index of the map with a larger one that
+**		can hold count entries. Only the stored hashes are used.
+**
+***********************************************************************/
+{
+	REBSER *hser = series->extra.series;
+	REBSER *nser = Make_Map_Index(count);
+	REBYTE *ctrl = MAP_CONTROL(hser);
+	REBMSL *slots = MAP_SLOTS(hser);
+	REBCNT n;
+
+	for (n = 0; n < SERIES_TAIL(hser); n++) {
+		if (!ctrl[n]) continue;
+		Set_Map_Slot(
+			nser,
+			Find_Map_Slot(series, nser, 0, slots[n].hash),
+			slots[n].index,
+			slots[n].hash
+		);
+	}
+
+	if (SERIES_GET_FLAG(hser, SER_MANAGED))
+		MANAGE_SERIES(nser);
+	else
+		Free_Series(hser);
+
+	series->extra.series = nser;
+
+	return nser;
+}
+
+
 /***********************************************************************
 **
 */	static REBSER *Make_Map(REBINT size)
@@ -81,7 +290,7 @@
 	REBSER *blk = Make_Array(size * 2);
 	REBSER *ser = 0;
 
-	if (size >= MIN_DICT) ser = Make_Hash_Sequence(size);
+	if (size >= MIN_DICT) ser = Make_Map_Index(size);
 
 	blk->extra.series = ser;
 
@@ -165,27 +374,80 @@
 }
 
 
+/***********************************************************************
+**
+*/	REBCNT Find_Key_Linear(const REBVAL *values, REBCNT len, const REBVAL *key, REBCNT cased)
+/*
+**		Search len values for a key, matching the way Find_Key()
+**		does but without a hash table. For the few values of a
+**		small block that is faster than building one.
+**
+**		Only words, strings and integers match exactly as they would
+**		in a table.  Other keys use Cmp_Value(), which counts close
+**		decimals (and dates in other zones) as equal, where a table
+**		only compares those that hash alike.
+**
+**		Returns the offset of the match, or NOT_FOUND.
+**		Keys that cannot be hashed are still an error.
+**
+***********************************************************************/
+{
+	const REBVAL *val = values;
+	REBCNT n;
+
+	if (!Hash_Value(key, 1)) raise Error_Has_Bad_Type(key);
+
+	if (ANY_WORD(key)) {
+		for (n = 0; n < len; n++, val++) {
+			if (
+				ANY_WORD(val) &&
+				(VAL_WORD_SYM(key) == VAL_WORD_SYM(val) ||
+				(!cased && VAL_WORD_CANON(key) == VAL_WORD_CANON(val)))
+			) return n;
+		}
+	}
+	else if (ANY_BINSTR(key)) {
+		for (n = 0; n < len; n++, val++) {
+			if (
+				VAL_TYPE(val) == VAL_TYPE(key)
+				&& 0 == Compare_String_Vals(key, val, (REBOOL)(!IS_BINARY(key) && !cased))
+			) return n;
+		}
+	} else {
+		for (n = 0; n < len; n++, val++) {
+			if (VAL_TYPE(val) == VAL_TYPE(key) && 0 == Cmp_Value(key, val, !cased)) return n;
+		}
+	}
+
+	return NOT_FOUND;
+}
+
+
 /***********************************************************************
 **
 */	static void Rehash_Hash(REBSER *series)
 /*
-**		Recompute the entire hash table. Table must be large enough.
+**		Recompute the entire hash table from the keys, growing it
+**		if needed. Where a key is repeated, the last one wins.
 **
 ***********************************************************************/
 {
+	REBSER *hser = series->extra.series;
 	REBVAL *val;
+	REBCNT hash;
 	REBCNT n;
-	REBCNT key;
-	REBCNT *hashes;
 
-	if (!series->extra.series) return;
+	if (!hser) return;
+
+	if (MAP_LIMIT(SERIES_TAIL(hser)) < series->tail / 2)
+		hser = Grow_Map_Index(series, series->tail / 2);
 
-	hashes = cast(REBCNT*, series->extra.series->data);
+	CLEAR(MAP_CONTROL(hser), SERIES_TAIL(hser) + MAP_GROUP);
 
 	val = BLK_HEAD(series);
 	for (n = 0; n < series->tail; n += 2, val += 2) {
-		key = Find_Key(series, series->extra.series, val, 2, 0, 0);
-		hashes[key] = n/2+1;
+		hash = Hash_Map_Key(val);
+		Set_Map_Slot(hser, Find_Map_Slot(series, hser, val, hash), n/2+1, hash);
 	}
 }
 
@@ -203,8 +465,8 @@
 ***********************************************************************/
 {
 	REBSER *hser = series->extra.series; // can be null
-	REBCNT *hashes;
 	REBCNT hash;
+	REBCNT slot;
 	REBVAL *v;
 	REBCNT n;
 
@@ -263,20 +525,18 @@
 
 		// Add hash table:
 		//Print("hash added %d", series->tail);
-		series->extra.series = hser = Make_Hash_Sequence(series->tail);
+		series->extra.series = hser = Make_Map_Index(series->tail/2 + 1);
 		MANAGE_SERIES(hser);
 		Rehash_Hash(series);
 	}
 
-	// Get hash table, expand it if needed:
-	if (series->tail > hser->tail/2) {
-		Expand_Hash(hser); // modifies size value
-		Rehash_Hash(series);
-	}
+	// Expand the hash table if a new entry would overfill it:
+	if (val && MAP_LIMIT(SERIES_TAIL(hser)) <= series->tail/2)
+		hser = Grow_Map_Index(series, series->tail/2 + 1);
 
-	hash = Find_Key(series, hser, key, 2, 0, 0);
-	hashes = (REBCNT*)hser->data;
-	n = hashes[hash];
+	hash = Hash_Map_Key(key);
+	slot = Find_Map_Slot(series, hser, key, hash);
+	n = MAP_CONTROL(hser)[slot] ? MAP_SLOTS(hser)[slot].index : 0;
 
 	// Just a GET of value:
 	if (!val) return n;
@@ -291,7 +551,8 @@
 	Append_Value(series, key);
 	Append_Value(series, val);  // does not copy value, e.g. if string
 
-	return (hashes[hash] = series->tail/2);
+	Set_Map_Slot(hser, slot, series->tail/2, hash);
+	return series->tail/2;
 }
 
 
@@ -373,8 +634,6 @@
 
 	Append_Map(series, data, UNKNOWN);
 
-	Rehash_Hash(series);
-
 	Val_Init_Map(out, series);
 
 	return TRUE;
@@ -427,7 +686,7 @@
 	REBSER *ser = 0;
 	REBCNT size = SERIES_TAIL(blk);
 
-	if (size >= MIN_DICT) ser = Make_Hash_Sequence(size);
+	if (size >= MIN_DICT) ser = Make_Map_Index(size / 2);
 	blk->extra.series = ser;
 	Rehash_Hash(blk);
 }
@@ -556,7 +815,10 @@
 
 	case A_CLEAR:
 		Reset_Array(series);
-		if (series->extra.series) Clear_Series(series->extra.series);
+		if (series->extra.series) {
+			REBSER *hser = series->extra.series;
+			CLEAR(MAP_CONTROL(hser), SERIES_TAIL(hser) + MAP_GROUP);
+		}
 		Val_Init_Map(D_OUT, series);
 		break;
 
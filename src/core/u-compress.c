@@ -358,3 +358,233 @@ static int window_bits_gzip_raw = -(MAX_WBITS | 16); // is "raw gzip" a thing?
 
 	return output;
 }
+
+
+//
+// Streaming compression keeps a z_stream alive between calls, so that data
+// can be fed through in chunks (see p-compress.c for the DEFLATE and
+// INFLATE port schemes built on it).
+//
+// The stream is held in a block: the first value is a BINARY! holding the
+// Reb_Zlib_Stream, the second a BINARY! of input not yet consumed, and
+// after them come BINARY!s for each allocation zlib asks for.  Since all
+// of it is series memory reachable from that block, an error raised
+// mid-stream (or a port that is never closed) leaks nothing: dropping the
+// block lets the GC take it all.  Series data does not move unless the
+// series is expanded, which the stream and zlib's allocations never are.
+//
+struct Reb_Zlib_Stream {
+	z_stream strm;
+	REBFLG deflating;
+	REBFLG envelope;	// add Rebol's 32-bit size at the end, as COMPRESS does
+	REBFLG finishing;	// no more input is coming
+	REBFLG ended;
+};
+
+#define ZLIB_STREAM(state) \
+	cast(struct Reb_Zlib_Stream*, VAL_BIN(BLK_HEAD(state)))
+
+#define ZLIB_PENDING(state) \
+	VAL_SERIES(BLK_SKIP(state, 1))
+
+#define ZLIB_CHUNK 0x8000 // most output held in the buffer at a time
+
+
+/***********************************************************************
+**
+*/	static voidpf Zlib_Alloc(voidpf opaque, uInt items, uInt size)
+/*
+**		This is called from inside of inflate() and deflate(), and an
+**		error raised here would leave the z_stream half-updated.  So
+**		a failed allocation returns Z_NULL, and zlib then gives back
+**		Z_MEM_ERROR for the caller to raise.
+**
+***********************************************************************/
+{
+	REBOL_STATE state;
+	const REBVAL *error;
+	REBSER *mem;
+
+	if (cast(REBU64, items) * size > MAX_I32) return Z_NULL;
+
+	PUSH_TRAP(&error, &state);
+
+// The first time through the following code 'error' will be NULL, but...
+// `raise Error` can longjmp here, so 'error' won't be NULL *if* that happens!
+
+	if (error) return Z_NULL;
+
+	mem = Make_Binary(items * size);
+	SERIES_TAIL(mem) = items * size; // zlib writes over the terminator
+	TERM_SEQUENCE(mem);
+	Val_Init_Binary(Alloc_Tail_Array(cast(REBSER*, opaque)), mem);
+
+	DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&state);
+
+	return BIN_HEAD(mem);
+}
+
+
+/***********************************************************************
+**
+*/	static void Zlib_Free(voidpf opaque, voidpf address)
+/*
+**		Memory goes back when the stream's block is garbage collected.
+**
+***********************************************************************/
+{
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Make_Zlib_Stream(REBFLG deflating, REBFLG gzip, REBFLG raw)
+/*
+**		Start a compression (or decompression) stream, with the same
+**		envelope choices as Compress() and Decompress().  Returns the
+**		block that holds the stream's state, which is then passed to
+**		Zlib_Stream_Run().  There is no "end" call: to stop, drop it.
+**
+***********************************************************************/
+{
+	REBSER *state = Make_Array(4);
+	REBSER *bin = Make_Binary(sizeof(struct Reb_Zlib_Stream));
+	struct Reb_Zlib_Stream *zs = cast(struct Reb_Zlib_Stream*, BIN_HEAD(bin));
+	int bits = raw
+		? (gzip ? window_bits_gzip_raw : window_bits_zlib_raw)
+		: (gzip ? window_bits_gzip : window_bits_zlib);
+	int ret;
+
+	CLEAR(zs, sizeof(struct Reb_Zlib_Stream));
+	SERIES_TAIL(bin) = sizeof(struct Reb_Zlib_Stream);
+	TERM_SEQUENCE(bin);
+	Val_Init_Binary(Alloc_Tail_Array(state), bin);
+	Val_Init_Binary(Alloc_Tail_Array(state), Make_Binary(0));
+
+	zs->strm.zalloc = Zlib_Alloc;
+	zs->strm.zfree = Zlib_Free;
+	zs->strm.opaque = state;
+	zs->deflating = deflating;
+	zs->envelope = deflating && !gzip && !raw;
+	zs->finishing = FALSE;
+	zs->ended = FALSE;
+
+	if (deflating)
+		ret = deflateInit2(
+			&zs->strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, bits, 8,
+			Z_DEFAULT_STRATEGY
+		);
+	else
+		ret = inflateInit2(&zs->strm, bits);
+
+	if (ret != Z_OK)
+		raise Error_Compression(&zs->strm, ret);
+
+	return state;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Zlib_Stream_Run(REBSER *state, REBSER *output, const REBYTE *input, REBCNT len, REBFLG finish)
+/*
+**		Feed len bytes into the stream, and append what comes out of
+**		it to the output BINARY!, until that holds ZLIB_CHUNK bytes.
+**		Input that could not be consumed yet is kept in the state, and
+**		the next call (with more input or none) carries on with it.
+**		So however much a small input would expand to, only a chunk
+**		of output is produced until the caller takes it away.
+**
+**		With finish, no more input is coming.  A compression stream
+**		then emits the rest of its output over the following calls.
+**		A decompression stream raises an error once all its input is
+**		consumed if the data has not reached its end.  Input after
+**		the end of compressed data is ignored (e.g. the size that
+**		COMPRESS puts after it).
+**
+**		Returns TRUE once the stream has ended.
+**
+***********************************************************************/
+{
+	struct Reb_Zlib_Stream *zs = ZLIB_STREAM(state);
+	REBSER *pending = ZLIB_PENDING(state);
+	REBCNT tail = SERIES_TAIL(output);
+	REBCNT room;
+	int ret;
+
+	if (zs->ended) return TRUE;
+
+	if (len != 0) Append_Series(pending, input, len);
+	if (finish) zs->finishing = TRUE;
+
+	if (tail >= ZLIB_CHUNK) return FALSE;
+
+	room = ZLIB_CHUNK - tail;
+	Extend_Series(output, room);
+
+	zs->strm.next_in = BIN_HEAD(pending);
+	zs->strm.avail_in = SERIES_TAIL(pending);
+	zs->strm.next_out = BIN_SKIP(output, tail);
+	zs->strm.avail_out = room;
+
+	if (zs->deflating)
+		ret = deflate(&zs->strm, zs->finishing ? Z_FINISH : Z_NO_FLUSH);
+	else
+		ret = inflate(&zs->strm, Z_NO_FLUSH);
+
+	SERIES_TAIL(output) = tail + room - zs->strm.avail_out;
+	SET_STR_END(output, SERIES_TAIL(output));
+
+	// Drop the input zlib took (all of it, if the stream has ended)
+	Remove_Series(
+		pending,
+		0,
+		ret == Z_STREAM_END
+			? SERIES_TAIL(pending)
+			: SERIES_TAIL(pending) - zs->strm.avail_in
+	);
+	zs->strm.next_in = NULL; // input may move or go away after this
+	zs->strm.avail_in = 0;
+
+	if (ret == Z_STREAM_END)
+		zs->ended = TRUE;
+	else if (ret != Z_OK && ret != Z_BUF_ERROR) // (BUF: no progress possible)
+		raise Error_Compression(&zs->strm, ret);
+	else if (
+		zs->finishing && !zs->deflating && zs->strm.avail_out != 0
+	) {
+		// All the input is used up, and it was not the whole stream
+		raise Error_Compression(&zs->strm, Z_BUF_ERROR);
+	}
+
+	if (zs->ended && zs->envelope) {
+		REBYTE out_size[sizeof(REBCNT)];
+		REBCNT_To_Bytes(out_size, cast(REBCNT, zs->strm.total_in));
+		Append_Series(output, out_size, sizeof(REBCNT));
+	}
+
+	return zs->ended;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Zlib_Stream_Finishing(REBSER *state)
+/*
+**		TRUE once the stream has been told no more input is coming
+**		(or it has ended by itself).
+**
+***********************************************************************/
+{
+	return ZLIB_STREAM(state)->finishing || ZLIB_STREAM(state)->ended;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Zlib_Stream_Ended(REBSER *state)
+/*
+***********************************************************************/
+{
+	return ZLIB_STREAM(state)->ended;
+}
@@ -175,6 +175,9 @@ Special internal defines used by RT, not Host-Kit developers:
 #ifdef TO_LINUX
 	#define HAS_POSIX_SIGNAL
 
+	#define HAS_EPOLL				// WAIT sleeps on an epoll set of sockets
+	#define HAS_THREADED_DNS		// lookups run on helper threads (pthreads)
+
 	// !!! The Atronix build introduced a differentiation between
 	// a Linux build and a POSIX build, and one difference is the
 	// usage of some signal functions that are not available if
@@ -211,6 +211,9 @@ struct rebol_devreq {
 			u32  remote_ip;			// remote address
 			u32  remote_port;		// remote port
 			void *host_info;		// for DNS usage
+			u32  transfer;			// max bytes per send/recv (0: default)
+			u32  send_buffer;		// SO_SNDBUF size (0: OS default)
+			u32  recv_buffer;		// SO_RCVBUF size (0: OS default)
 		} net;
 		struct {
 			REBCHR *path;			//device path string (in OS local format)
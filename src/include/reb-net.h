@@ -31,9 +31,17 @@ enum socket_types {
 	RST_UDP,					// TCP or UDP
 	RST_LISTEN = 8,				// LISTEN
 	RST_REVERSE,				// DNS reverse
+	RST_GATHER,					// write data is an array of REBIOV
 	RST_MAX
 };
 
+// One piece of a gathered write (RST_GATHER); the pieces' lengths
+// add up to at least the request's length.
+typedef struct rebol_net_iov {
+	REBYTE *data;
+	u32 length;
+} REBIOV;
+
 // REBOL Socket Modes (state flags)
 enum {
 	RSM_OPEN = 0,				// socket is allocated
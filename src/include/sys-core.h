@@ -41,6 +41,7 @@
 #define	MAX_NUM_LEN 64			// As many numeric digits we will accept on input
 #define MAX_SAFE_SERIES 5		// quanitity of most recent series to not GC.
 #define MAX_EXPAND_LIST 5		// number of series-1 in Prior_Expand list
+#define MAX_MINOR_RECYCLES 8	// minor recycles allowed between full recycles
 #define USE_UNICODE 1			// scanner uses unicode
 #define UNICODE_CASES 0x2E00	// size of unicode folding table
 #define HAS_SHA1				// allow it
@@ -180,7 +181,8 @@ enum {
 	MKS_PRESERVE	= 1 << 3,	// "Remake" only (save what data possible)
 	MKS_LOCK		= 1 << 4,	// series is unexpandable
 	MKS_GC_MANUALS	= 1 << 5,	// used in implementation of series itself
-	MKS_FRAME		= 1 << 6	// is a frame w/key series (and legal UNSETs)
+	MKS_FRAME		= 1 << 6,	// is a frame w/key series (and legal UNSETs)
+	MKS_EMBED		= 1 << 7	// Make_Series only: small data may go in node
 };
 
 // Modes allowed by Copy_Block function:
@@ -309,6 +311,7 @@ enum Insert_Arg_Nums {
 
 enum rebol_signals {
 	SIG_RECYCLE,
+	SIG_SWEEP,
 	SIG_ESCAPE,
 	SIG_EVENT_PORT,
 	SIG_MAX
@@ -995,6 +998,7 @@ typedef struct rebol_word_table
 {
 	REBSER	*series;	// Global block of words
 	REBSER	*hashes;	// Hash table
+	REBSER	*cache;		// Recently made words, by spelling (see Make_Word)
 //	REBCNT	count;		// Number of units used in hash table
 } WORD_TABLE;
 
@@ -1005,6 +1009,9 @@ typedef struct rebol_stats {
 	REBCNT	Series_Freed;
 	REBCNT	Series_Expanded;
 	REBCNT	Recycle_Counter;
+	REBCNT	Recycle_Minor;		// how many of the recycles were minor
+	REBI64	Recycle_Minor_Time;	// microseconds spent in minor recycles
+	REBI64	Recycle_Major_Time;	// microseconds spent in full recycles
 	REBCNT	Recycle_Series_Total;
 	REBCNT	Recycle_Series;
 	REBI64  Recycle_Prior_Eval;
@@ -89,6 +89,11 @@ TVAR REBOOL	GC_Active;		// TRUE when recycle is enabled (set by RECYCLE func)
 TVAR REBSER *GC_Series_Guard; // A stack of protected series (removed by pop)
 TVAR REBSER *GC_Value_Guard; // A stack of protected series (removed by pop)
 PVAR REBSER	*GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBSER *GC_Nursery;	// Series managed since the last recycle (young)
+TVAR REBSER *GC_Tenured;	// Managed series that survived a recycle (old)
+TVAR REBINT GC_Minor_Count;	// Minor recycles done since the last full one
+TVAR REBSER *GC_Doomed;		// Unreachable series not yet freed (see SIG_SWEEP)
+TVAR REBCNT GC_Sweep_Budget; // Series freed per sweep slice (0 = no slicing)
 TVAR REBFLG GC_Stay_Dirty;  // Do not free memory, fill it with 0xBB
 TVAR REBSER **Prior_Expand;	// Track prior series expansions (acceleration)
 
@@ -126,6 +131,13 @@ TVAR REBINT Trace_Depth;	// Tracks trace indentation
 TVAR REBCNT Trace_Limit;	// Backtrace buffering limit
 TVAR REBSER *Trace_Buffer;	// Holds backtrace lines
 
+//-- Function call profiler (see d-profile.c):
+TVAR REBFLG Profile_Active;	// PROFILE is on
+TVAR REBSER *Profile_Nodes;	// Calling-context tree of timings
+TVAR REBCNT Profile_Node;	// Node of the function now running
+TVAR REBI64 Profile_Child;	// Time spent so far in its callees
+TVAR REBCNT Profile_Generation; // Bumped whenever the nodes are reset
+
 TVAR REBI64 Eval_Natives;
 TVAR REBI64 Eval_Functions;
 
@@ -97,6 +97,7 @@ typedef void *REBNOD;			// Just used for linking free nodes
 	MEM_MID_POOLS   = MEM_SMALL_POOLS +  4,
 	MEM_BIG_POOLS   = MEM_MID_POOLS   +  4, // larger pools
 	SERIES_POOL     = MEM_BIG_POOLS,
+	EMBED_POOL, // series headers with room for small data after them
 	GOB_POOL,
 	LIB_POOL,
 	RIN_POOL, /* routine info */
@@ -108,6 +109,11 @@ typedef void *REBNOD;			// Just used for linking free nodes
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
 #define	MEM_MIN_SIZE sizeof(REBVAL)
+#define SERIES_EMBED_SIZE (2 * sizeof(REBVAL)) // data kept in an EMBED_POOL node
+
+// Step to the next header when walking the units of SERIES_POOL or EMBED_POOL:
+#define NEXT_SERIES_NODE(s, pool) \
+	cast(REBSER*, cast(REBYTE*, (s)) + Mem_Pools[pool].wide)
 #define MEM_BIG_SIZE 1024
 
 #define MEM_BALLAST 3000000
@@ -253,6 +253,16 @@ struct Reb_Call {
 	REBVAL vars[1];		// (array exceeds struct, but cannot be [0] in C++)
 };
 
+// Bookkeeping for one profiled call, kept on the C stack by
+// Dispatch_Call_Throws (see Profile_Enter and Profile_Leave)
+struct Reb_Prof_Frame {
+	REBCNT generation;	// Profile_Generation at entry
+	REBCNT node;		// node this call is recorded against
+	REBCNT parent;		// node of the caller, restored on leaving
+	REBI64 child;		// caller's Profile_Child, resumed on leaving
+	REBI64 start;		// clock at entry
+};
+
 #define DSF_NUM_VARS(c)	((c)->num_vars)
 
 // Size must compensate -1 for the already-accounted-for length one array
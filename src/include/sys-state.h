@@ -102,6 +102,10 @@ typedef struct Rebol_State {
 
 	REBCNT manuals_tail;	// Where GC_Manuals was when state started
 
+	REBCNT profile_node;	// Profile_Node and Profile_Child when started
+	REBI64 profile_child;
+	REBCNT profile_generation; // Profile_Generation those belong to
+
 #ifdef HAS_POSIX_SIGNAL
 	sigjmp_buf cpu_state;
 #else
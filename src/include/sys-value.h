@@ -480,9 +480,7 @@ typedef struct Reb_Tuple {
 	REBCNT	tail;		// one past end of useful data
 	REBCNT	rest;		// total number of units from bias to end
 	REBINT	info;		// holds width and flags
-#if defined(__LP64__) || defined(__LLP64__)
-	REBCNT padding; /* make next pointer is naturally aligned */
-#endif
+	REBCNT	node_pool;	// pool this header came from (SERIES or EMBED)
 	union {
 		REBCNT size;	// used for vectors and bitsets
 		REBSER *series;	// MAP datatype uses this
@@ -532,6 +530,12 @@ typedef struct Reb_Tuple {
 // Flag: If wide field is not set, series is free (not used):
 #define	SERIES_FREED(s)  (!SERIES_WIDE(s))
 
+// Data lives in the node right after the header (see EMBED_POOL):
+#define SERIES_EMBED_DATA(s) cast(REBYTE*, (s) + 1)
+#define SERIES_EMBEDDED(s) \
+	((s)->node_pool == EMBED_POOL \
+	&& (s)->data - SERIES_BIAS(s) * SERIES_WIDE(s) == SERIES_EMBED_DATA(s))
+
 // Size in bytes of memory allocated (including bias area):
 #define SERIES_TOTAL(s) ((SERIES_REST(s) + SERIES_BIAS(s)) * (REBCNT)SERIES_WIDE(s))
 // Size in bytes of series (not including bias area):
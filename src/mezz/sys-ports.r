@@ -327,6 +327,24 @@ init-schemes: func [
 		name: 'clipboard
 	]
 
+	make-scheme [
+		title: "Streaming Compression"
+		name: 'deflate
+		spec: system/standard/port-spec-zlib
+	]
+
+	make-scheme [
+		title: "Streaming Decompression"
+		name: 'inflate
+		spec: system/standard/port-spec-zlib
+	]
+
+	make-scheme [
+		title: "Running Checksum"
+		name: 'checksum
+		spec: system/standard/port-spec-checksum
+	]
+
 	if 4 == fourth system/version [
 		make-scheme [
 			title: "Signal"
@@ -24,6 +24,7 @@
 **  Purpose: Calls local DNS services for domain name lookup.
 **  Notes:
 **      See MS WSAAsyncGetHost* details regarding multiple requests.
+**      On Linux, lookups are run on helper threads (host-resolve.c).
 **
 ************************************************************************
 **
@@ -54,6 +55,13 @@ extern void Signal_Device(REBREQ *req, REBINT type);
 extern HWND Event_Handle;
 #endif
 
+#ifdef HAS_THREADED_DNS
+// Lookups run on helper threads (see host-resolve.c)
+extern void *Resolve_Start(const char *host, u32 ip, REBOOL reverse);
+extern int Resolve_Poll(void *lookup, u32 *ip, char **name, int *error);
+extern void Resolve_Free(void *lookup);
+#endif
+
 /***********************************************************************
 **
 */	DEVICE_CMD Open_DNS(REBREQ *sock)
@@ -80,7 +88,12 @@ extern HWND Event_Handle;
 		if (sock->requestee.handle) WSACancelAsyncRequest(sock->requestee.handle);
 	}
 #endif
+#ifdef HAS_THREADED_DNS
+	// (abandons the lookup if it is still running)
+	if (sock->special.net.host_info) Resolve_Free(sock->special.net.host_info);
+#else
 	if (sock->special.net.host_info) OS_FREE(sock->special.net.host_info);
+#endif
 	sock->special.net.host_info = 0;
 	sock->requestee.handle = 0;
 	SET_CLOSED(sock);
@@ -88,6 +101,58 @@ extern HWND Event_Handle;
 }
 
 
+#ifdef HAS_THREADED_DNS
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Read_DNS(REBREQ *sock)
+/*
+**		Start the lookup on a helper thread and return immediately,
+**		unless the answer is already known (an address, or a name
+**		that is cached).  The lookup is kept in host_info until the
+**		request is closed, as the name of a reverse lookup is in it.
+**
+***********************************************************************/
+{
+	void *lookup;
+	char *name;
+	int state;
+
+	if (sock->special.net.host_info) Resolve_Free(sock->special.net.host_info);
+	sock->special.net.host_info = 0;
+	CLR_FLAG(sock->flags, RRF_DONE);
+	sock->error = 0;
+
+	lookup = Resolve_Start(
+		s_cast(sock->common.data),
+		sock->special.net.remote_ip,
+		GET_FLAG(sock->modes, RST_REVERSE)
+	);
+	if (!lookup) {
+		sock->error = ENOMEM;
+		return DR_ERROR;
+	}
+
+	// An address or a cached name is known right away:
+	state = Resolve_Poll(
+		lookup, &sock->special.net.remote_ip, &name, &sock->error
+	);
+	if (state > 0) {
+		sock->special.net.host_info = lookup;
+		return DR_PEND; // Poll_DNS() finishes it
+	}
+	if (state < 0) {
+		Resolve_Free(lookup);
+		return DR_ERROR;
+	}
+	sock->special.net.host_info = lookup;
+	if (GET_FLAG(sock->modes, RST_REVERSE)) sock->common.data = b_cast(name);
+	SET_FLAG(sock->flags, RRF_DONE);
+	return DR_DONE;
+}
+
+#else
+
 /***********************************************************************
 **
 */	DEVICE_CMD Read_DNS(REBREQ *sock)
@@ -149,6 +214,8 @@ extern HWND Event_Handle;
 	return DR_ERROR; // Remove it from pending list
 }
 
+#endif
+
 
 /***********************************************************************
 **
@@ -166,10 +233,45 @@ extern HWND Event_Handle;
 	REBREQ *req;
 	REBOOL change = FALSE;
 	HOSTENT *host;
+#ifdef HAS_THREADED_DNS
+	char *name;
+#endif
 
 	// Scan the pending request list:
 	for (req = *prior; req; req = *prior) {
 
+#ifdef HAS_THREADED_DNS
+		// Nothing marks these done, so ask the lookup itself.  The
+		// name found by a reverse lookup belongs to it (until closed).
+		if (req->special.net.host_info) {
+			int state = Resolve_Poll(
+				req->special.net.host_info,
+				&req->special.net.remote_ip,
+				&name,
+				&req->error
+			);
+			if (state > 0) {
+				prior = &req->next;
+				continue;
+			}
+
+			*prior = req->next;
+			req->next = 0;
+			CLR_FLAG(req->flags, RRF_PENDING);
+			SET_FLAG(req->flags, RRF_DONE);
+
+			if (state == 0) {
+				if (GET_FLAG(req->modes, RST_REVERSE))
+					req->common.data = b_cast(name);
+				Signal_Device(req, EVT_READ);
+			}
+			else
+				Signal_Device(req, EVT_ERROR);
+			change = TRUE;
+			continue;
+		}
+#endif
+
 		// If done or error, remove command from list:
 		if (GET_FLAG(req->flags, RRF_DONE)) { // req->error may be set
 			*prior = req->next;
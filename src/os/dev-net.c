@@ -42,6 +42,14 @@
 #include "reb-host.h"
 #include "sys-net.h"
 
+#ifdef HAS_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#ifndef TO_WINDOWS
+#include <sys/uio.h>
+#endif
+
 #if (0)
 #define WATCH1(s,a) printf(s, a)
 #define WATCH2(s,a,b) printf(s, a, b)
@@ -60,6 +68,15 @@ typedef int socklen_t;
 extern HWND Event_Handle; // For WSAAsync API
 #endif
 
+#ifdef HAS_THREADED_DNS
+// Lookups run on helper threads (see host-resolve.c)
+extern void *Resolve_Start(const char *host, u32 ip, REBOOL reverse);
+extern int Resolve_Poll(void *lookup, u32 *ip, char **name, int *error);
+extern void Resolve_Free(void *lookup);
+extern int Resolver_Wake_Fd(void);
+extern void Drain_Resolver_Wakes(void);
+#endif
+
 
 /***********************************************************************
 **
@@ -104,6 +121,295 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 }
 
 
+/***********************************************************************
+**
+*/	static REBOOL Set_Buffer_Sizes(REBREQ *sock)
+/*
+**		Apply the SO_SNDBUF and SO_RCVBUF sizes asked for by the port
+**		(zero leaves the OS default).  Return TRUE if no error.
+**
+***********************************************************************/
+{
+	int size;
+
+	if (sock->special.net.send_buffer) {
+		size = sock->special.net.send_buffer;
+		if (setsockopt(
+			sock->requestee.socket, SOL_SOCKET, SO_SNDBUF,
+			cast(char*, &size), sizeof(size)
+		)) return FALSE;
+	}
+
+	if (sock->special.net.recv_buffer) {
+		size = sock->special.net.recv_buffer;
+		if (setsockopt(
+			sock->requestee.socket, SOL_SOCKET, SO_RCVBUF,
+			cast(char*, &size), sizeof(size)
+		)) return FALSE;
+	}
+
+	return TRUE;
+}
+
+
+#define MAX_GATHER 64	// Max pieces per gathered send
+
+/***********************************************************************
+**
+*/	static long Send_Gathered(REBREQ *sock, SOCKAI *addr, long len)
+/*
+**		Send up to len bytes of a gathered write (RST_GATHER), starting
+**		sock->actual bytes into its pieces, in one system call.
+**
+**		Returns the bytes sent, or -1 with the error in GET_ERROR.
+**
+***********************************************************************/
+{
+	REBIOV *piece = cast(REBIOV*, sock->common.data);
+	u32 skip = sock->actual;
+
+	// Find the first piece not yet (all) sent:
+	for (; skip >= piece->length && len > 0; piece++) skip -= piece->length;
+
+#ifdef TO_WINDOWS
+	// No gathering sends in WinSock 1: send the rest of one piece
+	if (len > cast(long, piece->length - skip))
+		len = piece->length - skip;
+	return sendto(
+		sock->requestee.socket, s_cast(piece->data + skip), len, 0,
+		cast(struct sockaddr*, addr), sizeof(*addr)
+	);
+#else
+	{
+		struct iovec iov[MAX_GATHER];
+		struct msghdr msg;
+		int count = 0;
+
+		for (; len > 0 && count < MAX_GATHER; piece++) {
+			u32 n = piece->length - skip;
+			if (n == 0) continue;
+			if (cast(long, n) > len) n = len;
+			iov[count].iov_base = piece->data + skip;
+			iov[count].iov_len = n;
+			count++;
+			len -= n;
+			skip = 0;
+		}
+
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_name = addr;
+		msg.msg_namelen = sizeof(*addr);
+		msg.msg_iov = iov;
+		msg.msg_iovlen = count;
+
+		return sendmsg(sock->requestee.socket, &msg, 0);
+	}
+#endif
+}
+
+
+#ifdef HAS_EPOLL
+
+// All sockets of the network device are kept in one epoll set.  The event
+// device sleeps on it in Query_Events() instead of a plain select() timer,
+// and Poll_Net() only retries those requests whose socket was reported
+// as ready, so a WAIT costs O(ready) system calls instead of O(pending).
+//
+// Sockets are registered edge-triggered for both directions.  A ready mark
+// is set when epoll reports the socket, and is cleared only when the socket
+// operation says it would block.  The marks are indexed by the socket
+// handle (not by the request) because Accept_New_Port() copies the request
+// of an accepted connection into the port state and frees the original.
+
+#define NET_READ_READY	1
+#define NET_WRITE_READY	2
+#define NET_WATCHED		4
+
+static int Epoll_Fd = -1;
+static REBYTE *Net_Marks = 0;	// per socket handle: NET_xxx flags
+static int Net_Marks_Size = 0;
+
+#ifdef HAS_THREADED_DNS
+// Readable when a lookup finishes, so that its request gets polled.
+// It is in the epoll set level-triggered, and has no mark.
+static int Resolve_Fd = -1;
+#endif
+
+static void Watch_Socket(SOCKET sock)
+{
+	// Add the socket to the epoll set.  If that is not possible the
+	// socket is left unwatched, which makes Poll_Net() always retry it.
+	struct epoll_event ev;
+	int size;
+	REBYTE *marks;
+
+	if (Epoll_Fd < 0) return;
+
+	if (cast(int, sock) >= Net_Marks_Size) {
+		size = Net_Marks_Size ? Net_Marks_Size : 64;
+		while (size <= cast(int, sock)) size *= 2;
+		marks = OS_ALLOC_ARRAY_ZEROFILL(REBYTE, size);
+		if (!marks) return;
+		if (Net_Marks) {
+			memcpy(marks, Net_Marks, Net_Marks_Size);
+			OS_FREE(Net_Marks);
+		}
+		Net_Marks = marks;
+		Net_Marks_Size = size;
+	}
+
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+	ev.data.fd = sock;
+	if (epoll_ctl(Epoll_Fd, EPOLL_CTL_ADD, sock, &ev) < 0) {
+		Net_Marks[sock] = 0;
+		return;
+	}
+
+	// Not known to be blocked yet, so let the first attempt happen:
+	Net_Marks[sock] = NET_WATCHED | NET_READ_READY | NET_WRITE_READY;
+}
+
+static void Unwatch_Socket(SOCKET sock)
+{
+	// Remove the socket from the epoll set (before it is closed).
+	struct epoll_event ev; // (pre-2.6.9 kernels require non-NULL)
+
+	if (cast(int, sock) >= Net_Marks_Size || !Net_Marks[sock]) return;
+	epoll_ctl(Epoll_Fd, EPOLL_CTL_DEL, sock, &ev);
+	Net_Marks[sock] = 0;
+}
+
+static void Mark_Blocked(SOCKET sock, REBYTE ready)
+{
+	// The socket operation would block; wait for epoll to say otherwise.
+	if (cast(int, sock) < Net_Marks_Size) Net_Marks[sock] &= ~ready;
+}
+
+static REBOOL Is_Ready(REBREQ *sock)
+{
+	// Would calling the request's command again make any progress?
+	REBYTE marks;
+
+	if (
+		sock->requestee.socket < 0
+		|| sock->requestee.socket >= Net_Marks_Size
+	) {
+		return TRUE;
+	}
+
+	marks = Net_Marks[sock->requestee.socket];
+	if (!marks) return TRUE; // not watched
+
+	switch (sock->command) {
+	case RDC_READ:
+	case RDC_CREATE: // accept
+		return (marks & NET_READ_READY) ? TRUE : FALSE;
+
+	case RDC_WRITE:
+	case RDC_CONNECT:
+		return (marks & NET_WRITE_READY) ? TRUE : FALSE;
+	}
+
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	int Wait_Net_Events(REBCNT millisec)
+/*
+**		Sleep until a watched socket becomes ready, or until the
+**		timeout (in milliseconds) expires.  Called by the event device
+**		to implement the WAIT timer.
+**
+**		Returns the number of sockets that became ready, or -1 if
+**		there is no epoll set (so the caller must use another timer).
+**
+***********************************************************************/
+{
+	struct epoll_event events[64];
+	int count;
+	int n;
+	int fd;
+
+	if (Epoll_Fd < 0) return -1;
+
+	count = epoll_wait(Epoll_Fd, events, 64, cast(int, millisec));
+	if (count < 0) return (errno == EINTR) ? 0 : -1;
+
+	for (n = 0; n < count; n++) {
+		fd = events[n].data.fd;
+#ifdef HAS_THREADED_DNS
+		if (fd == Resolve_Fd) {
+			Drain_Resolver_Wakes();
+			continue;
+		}
+#endif
+		if (fd >= Net_Marks_Size || !Net_Marks[fd]) continue;
+
+		// Errors and hangups wake both directions, so that the pending
+		// command runs and reports what happened:
+		if (events[n].events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP))
+			Net_Marks[fd] |= NET_READ_READY;
+		if (events[n].events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+			Net_Marks[fd] |= NET_WRITE_READY;
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	DEVICE_CMD Poll_Net(REBREQ *dr)
+/*
+**		Retry the pending requests whose sockets are ready.
+**		Same contract as the default device polling: returns TRUE
+**		if the status of any request changed.
+**
+***********************************************************************/
+{
+	REBDEV *dev = (REBDEV*)dr;
+	REBREQ **prior = &dev->pending;
+	REBREQ *req;
+	REBOOL change = FALSE;
+	int result;
+
+	for (req = *prior; req; req = *prior) {
+
+		if (req->command < RDC_MAX && !Is_Ready(req)) {
+			prior = &req->next;
+			continue;
+		}
+
+		// Call command again:
+		if (req->command < RDC_MAX) {
+			CLR_FLAG(req->flags, RRF_ACTIVE);
+			result = dev->commands[req->command](req);
+		} else {
+			result = -1;	// invalid command, remove it
+			req->error = ((REBCNT)-1);
+		}
+
+		// If done or error, remove command from list:
+		if (result <= 0) {
+			*prior = req->next;
+			req->next = 0;
+			CLR_FLAG(req->flags, RRF_PENDING);
+			change = TRUE;
+		} else {
+			prior = &req->next;
+			if (GET_FLAG(req->flags, RRF_ACTIVE)) change = TRUE;
+		}
+	}
+
+	return change;
+}
+
+#endif // HAS_EPOLL
+
+
 /***********************************************************************
 **
 */	DEVICE_CMD Init_Net(REBREQ *dr)
@@ -119,6 +425,23 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	// Initialize Windows Socket API with given VERSION.
 	// It is ok to call twice, as long as WSACleanup twice.
 	if (WSAStartup(0x0101, &wsaData)) return DR_ERROR;
+#endif
+#ifdef HAS_EPOLL
+	// Failure is not fatal, WAIT just falls back to the select() timer.
+	// (This init is shared with the DNS device, so may be called twice.)
+	if (Epoll_Fd < 0) {
+		Epoll_Fd = epoll_create(64);
+#ifdef HAS_THREADED_DNS
+		Resolve_Fd = Resolver_Wake_Fd();
+		if (Epoll_Fd >= 0 && Resolve_Fd >= 0) {
+			struct epoll_event ev;
+			memset(&ev, 0, sizeof(ev));
+			ev.events = EPOLLIN;
+			ev.data.fd = Resolve_Fd;
+			epoll_ctl(Epoll_Fd, EPOLL_CTL_ADD, Resolve_Fd, &ev);
+		}
+#endif
+	}
 #endif
 	SET_FLAG(dev->flags, RDF_INIT);
 	return DR_DONE;
@@ -136,6 +459,13 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	REBDEV *dev = (REBDEV*)dr; // just to keep compiler happy
 #ifdef TO_WINDOWS
 	if (GET_FLAG(dev->flags, RDF_INIT)) WSACleanup();
+#endif
+#ifdef HAS_EPOLL
+	if (Epoll_Fd >= 0) close(Epoll_Fd);
+	Epoll_Fd = -1;
+	if (Net_Marks) OS_FREE(Net_Marks);
+	Net_Marks = 0;
+	Net_Marks_Size = 0;
 #endif
 	CLR_FLAG(dev->flags, RDF_INIT);
 	return DR_DONE;
@@ -221,6 +551,15 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 		return DR_ERROR;
 	}
 
+	if (!Set_Buffer_Sizes(sock)) {
+		sock->error = GET_ERROR;
+		return DR_ERROR;
+	}
+
+#ifdef HAS_EPOLL
+	Watch_Socket(sock->requestee.socket);
+#endif
+
 	return DR_DONE;
 }
 
@@ -244,13 +583,22 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 
 		// If DNS pending, abort it:
 		if (sock->special.net.host_info) {  // indicates DNS phase active
+#ifdef HAS_THREADED_DNS
+			Resolve_Free(sock->special.net.host_info);
+			sock->special.net.host_info = 0;
+#else
 #ifdef HAS_ASYNC_DNS
 			if (sock->requestee.handle) WSACancelAsyncRequest(sock->requestee.handle);
 #endif
 			OS_FREE(sock->special.net.host_info);
 			sock->requestee.socket = sock->length; // Restore TCP socket (see Lookup)
+#endif
 		}
 
+#ifdef HAS_EPOLL
+		Unwatch_Socket(sock->requestee.socket);
+#endif
+
 		if (CLOSE_SOCKET(sock->requestee.socket)) {
 			sock->error = GET_ERROR;
 			return DR_ERROR;
@@ -277,7 +625,11 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 #ifdef TO_WINDOWS
 	HANDLE handle;
 #endif
+#ifdef HAS_THREADED_DNS
+	int result;
+#else
 	HOSTENT *host;
+#endif
 
 #ifdef HAS_ASYNC_DNS
 	// Check if we are polling for completion:
@@ -308,6 +660,41 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 		return DR_PEND; // keep it on pending list
 	}
 	OS_FREE(host);
+#elif defined(HAS_THREADED_DNS)
+	// The lookup runs on a helper thread, and is kept in host_info while
+	// the request is polled (the TCP socket stays where it is):
+	if (!sock->special.net.host_info) {
+		sock->special.net.host_info = Resolve_Start(
+			s_cast(sock->common.data), 0, FALSE
+		);
+		if (!sock->special.net.host_info) {
+			sock->error = ENOMEM;
+			return DR_ERROR;
+		}
+	}
+
+	result = Resolve_Poll(
+		sock->special.net.host_info,
+		&sock->special.net.remote_ip,
+		NULL,
+		&sock->error
+	);
+	if (result > 0) return DR_PEND; // keep it on pending list
+
+	Resolve_Free(sock->special.net.host_info);
+	sock->special.net.host_info = 0;
+	CLR_FLAG(sock->flags, RRF_DONE);
+
+	if (result == 0) {
+		Signal_Device(sock, EVT_LOOKUP);
+		return DR_DONE;
+	}
+	if (GET_FLAG(sock->flags, RRF_PENDING)) {
+		// As with the async lookup, failing later is an event:
+		Signal_Device(sock, EVT_ERROR);
+		return DR_DONE;
+	}
+	return DR_ERROR; // Remove it from pending list
 #else
 	// Use old-style blocking DNS (mainly for testing purposes):
 	host = gethostbyname(s_cast(sock->common.data));
@@ -392,6 +779,9 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	case NE_ALREADY:
 		// Still trying:
 		SET_FLAG(sock->state, RSM_ATTEMPT);
+#ifdef HAS_EPOLL
+		Mark_Blocked(sock->requestee.socket, NET_WRITE_READY);
+#endif
 		return DR_PEND;
 
 	default:
@@ -415,6 +805,10 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 **
 **		The mode is RSM_RECEIVE or RSM_SEND.
 **
+**		A send with the RST_GATHER mode takes sock->common.data to be
+**		an array of REBIOV pieces, which go out together (see
+**		Send_Gathered).
+**
 **		The function will return:
 **			=0: succeeded
 **			>0: in-progress, still trying
@@ -445,21 +839,28 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	SET_FLAG(sock->state, mode);
 
 	// Limit size of transfer:
-	len = MIN(sock->length - sock->actual, MAX_TRANSFER);
+	len = MIN(
+		sock->length - sock->actual,
+		sock->special.net.transfer ? sock->special.net.transfer : MAX_TRANSFER
+	);
 
 	if (mode == RSM_SEND) {
 		// If host is no longer connected:
 		Set_Addr(&remote_addr, sock->special.net.remote_ip, sock->special.net.remote_port);
-		result = sendto(
-			sock->requestee.socket,
-            s_cast(sock->common.data), len,
-			0, // Flags
-			cast(struct sockaddr*, &remote_addr), addr_len
-		);
+		if (GET_FLAG(sock->modes, RST_GATHER))
+			result = Send_Gathered(sock, &remote_addr, len);
+		else
+			result = sendto(
+				sock->requestee.socket,
+				s_cast(sock->common.data), len,
+				0, // Flags
+				cast(struct sockaddr*, &remote_addr), addr_len
+			);
 		WATCH2("send() len: %d actual: %d\n", len, result);
 
 		if (result >= 0) {
-			sock->common.data += result;
+			if (!GET_FLAG(sock->modes, RST_GATHER))
+				sock->common.data += result;
 			sock->actual += result;
 			if (sock->actual >= sock->length) {
 				Signal_Device(sock, EVT_WROTE);
@@ -500,7 +901,15 @@ static REBOOL Nonblocking_Mode(SOCKET sock)
 	// Check error code:
 	result = GET_ERROR;
 	WATCH2("get error: %d %s\n", result, strerror(result));
-	if (result == NE_WOULDBLOCK) return DR_PEND; // still waiting
+	if (result == NE_WOULDBLOCK) { // still waiting
+#ifdef HAS_EPOLL
+		Mark_Blocked(
+			sock->requestee.socket,
+			mode == RSM_SEND ? NET_WRITE_READY : NET_READ_READY
+		);
+#endif
+		return DR_PEND;
+	}
 
 	WATCH4("ERROR: recv(%d %x) len: %d error: %d\n", sock->requestee.socket, sock->common.data, len, result);
 	// A nasty error happened:
@@ -594,7 +1003,12 @@ lserr:
 
 	if (result == BAD_SOCKET) {
 		result = GET_ERROR;
-		if (result == NE_WOULDBLOCK) return DR_PEND;
+		if (result == NE_WOULDBLOCK) {
+#ifdef HAS_EPOLL
+			Mark_Blocked(sock->requestee.socket, NET_READ_READY);
+#endif
+			return DR_PEND;
+		}
 		sock->error = result;
 		//Signal_Device(sock, EVT_ERROR);
 		return DR_ERROR;
@@ -613,12 +1027,17 @@ lserr:
 	SET_FLAG(news->state, RSM_CONNECT);
 
 	news->requestee.socket = result;
+	news->special.net.transfer = sock->special.net.transfer;
 	news->special.net.remote_ip   = sa.sin_addr.s_addr; //htonl(ip); NOTE: REBOL stays in network byte order
 	news->special.net.remote_port = ntohs(sa.sin_port);
 	Get_Local_IP(news);
 
 	Nonblocking_Mode(news->requestee.socket);
 
+#ifdef HAS_EPOLL
+	Watch_Socket(news->requestee.socket);
+#endif
+
 	Attach_Request(cast(REBREQ**, &sock->common.data), news);
 	Signal_Device(sock, EVT_ACCEPT);
 
@@ -640,7 +1059,11 @@ static DEVICE_CMD_FUNC Dev_Cmds[RDC_MAX] = {
 	Close_Socket,
 	Transfer_Socket,		// Read
 	Transfer_Socket,		// Write
+#ifdef HAS_EPOLL
+	Poll_Net,
+#else
 	0,	// poll
+#endif
 	Connect_Socket,
 	0,	// query
 	0,	// modify
@@ -0,0 +1,844 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  Copyright 2015 Rebol Open Source Contributors
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Title: Host name lookups on helper threads
+**  Author: Ren/C contributors
+**  Purpose:
+**      Lets the DNS and network devices start a lookup and poll for
+**      its result, instead of blocking the interpreter in a resolver.
+**  Notes:
+**
+**      Lookups are run by a few helper threads, started as needed.
+**      When one finishes, a byte is written to a pipe that is in the
+**      network device's epoll set, so a WAIT wakes up to poll for it.
+**
+**      A name is looked for in /etc/hosts, then asked of the name
+**      servers in /etc/resolv.conf with a small UDP DNS client, so
+**      that the answer's TTL is known and it can be cached for that
+**      long.  Anything the client can't answer (no server, a timeout,
+**      a name that doesn't exist in DNS, a name with no dot that the
+**      search list applies to) is left to getaddrinfo(), uncached.
+**
+**      The REBOL_DNS_SERVER environment variable (ip or ip:port) sets
+**      the one name server to use instead, such as a stand-in server
+**      for testing.
+**
+**      Only IPv4 addresses are found, as the network device only
+**      connects over IPv4.
+**
+************************************************************************
+**
+**  NOTE to PROGRAMMERS:
+**
+**    1. Keep code clear and simple.
+**    2. Document unusual code, reasoning, or gotchas.
+**    3. Use same style for code, vars, indent(4), comments, etc.
+**    4. Keep in mind Linux, OS X, BSD, big/little endian CPUs.
+**    5. Test everything, then test it again.
+**
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <pthread.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "reb-host.h"
+
+#define MAX_RESOLVERS	4		// helper threads
+#define DNS_CACHE_SIZE	64		// names held with their TTL
+#define DNS_MAX_TTL		86400	// seconds (longest a name is cached)
+#define DNS_SERVERS		3		// most name servers tried (as resolv.conf)
+#define DNS_TRIES		2		// times each server is asked
+#define DNS_TIMEOUT		2000	// msec to wait for each answer
+#define DNS_MAX_MSG		512		// UDP message size without EDNS
+
+#define DNS_TYPE_A		1
+#define DNS_TYPE_CNAME	5
+#define DNS_CLASS_IN	1
+
+enum {
+	RESOLVE_FAILED = -1,
+	RESOLVE_DONE = 0,
+	RESOLVE_PENDING = 1
+};
+
+typedef struct Resolve_Job {
+	struct Resolve_Job *next;	// in the queue for the helper threads
+	int state;					// RESOLVE_xxx
+	int error;					// getaddrinfo() or getnameinfo() code
+	REBOOL reverse;				// find the name of the ip
+	REBOOL abandoned;			// helper frees it when done
+	u32 ip;						// network byte order
+	char name[NI_MAXHOST];		// name to look up (or that was found)
+} REBRSV;
+
+struct Cached_Name {
+	char name[NI_MAXHOST];
+	u32 ip;
+	time_t expires;				// 0 if the slot is unused
+};
+
+static pthread_mutex_t Resolve_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Resolve_Work = PTHREAD_COND_INITIALIZER;
+
+// These are only used with the lock held:
+static REBRSV *Queue_Head = 0;
+static REBRSV *Queue_Tail = 0;
+static int Queue_Length = 0;
+static int Num_Resolvers = 0;
+static int Idle_Resolvers = 0;
+static struct Cached_Name Name_Cache[DNS_CACHE_SIZE];
+
+static int Wake_Fds[2] = {-1, -1};
+
+
+/***********************************************************************
+**
+*/	static time_t Now_Secs(void)
+/*
+***********************************************************************/
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Find_Cached_Name(const char *name, u32 *ip)
+/*
+**		Lock must be held.
+**
+***********************************************************************/
+{
+	time_t now = Now_Secs();
+	int n;
+
+	for (n = 0; n < DNS_CACHE_SIZE; n++) {
+		if (
+			Name_Cache[n].expires > now
+			&& strcasecmp(Name_Cache[n].name, name) == 0
+		) {
+			*ip = Name_Cache[n].ip;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Cache_Name(const char *name, u32 ip, u32 ttl)
+/*
+**		Hold the address of a name for ttl seconds.  Takes the place
+**		of the same name, else of the entry that expires soonest.
+**		Lock must be held.
+**
+***********************************************************************/
+{
+	int slot = 0;
+	int n;
+
+	if (ttl == 0) return;
+	if (ttl > DNS_MAX_TTL) ttl = DNS_MAX_TTL;
+
+	for (n = 0; n < DNS_CACHE_SIZE; n++) {
+		if (strcasecmp(Name_Cache[n].name, name) == 0) {
+			slot = n;
+			break;
+		}
+		if (Name_Cache[n].expires < Name_Cache[slot].expires) slot = n;
+	}
+
+	strncpy(Name_Cache[slot].name, name, NI_MAXHOST - 1);
+	Name_Cache[slot].name[NI_MAXHOST - 1] = 0;
+	Name_Cache[slot].ip = ip;
+	Name_Cache[slot].expires = Now_Secs() + ttl;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Find_In_Hosts(const char *name, u32 *ip)
+/*
+**		Look for the name in /etc/hosts (IPv4 lines only).
+**
+***********************************************************************/
+{
+	FILE *file = fopen("/etc/hosts", "r");
+	char line[512];
+	char *word;
+	char *rest;
+	struct in_addr addr;
+	REBOOL found = FALSE;
+
+	if (!file) return FALSE;
+
+	while (!found && fgets(line, sizeof(line), file)) {
+		if ((word = strchr(line, '#'))) *word = 0;
+
+		word = strtok_r(line, " \t\r\n", &rest);
+		if (!word || inet_pton(AF_INET, word, &addr) != 1) continue;
+
+		while ((word = strtok_r(NULL, " \t\r\n", &rest))) {
+			if (strcasecmp(word, name) == 0) {
+				*ip = addr.s_addr;
+				found = TRUE;
+				break;
+			}
+		}
+	}
+
+	fclose(file);
+	return found;
+}
+
+
+/***********************************************************************
+**
+*/	static int Get_Name_Servers(struct sockaddr_in *servers)
+/*
+**		Fill in the addresses of the name servers to ask, returning
+**		how many there are (up to DNS_SERVERS).
+**
+***********************************************************************/
+{
+	char *env = getenv("REBOL_DNS_SERVER");
+	char line[256];
+	char *word;
+	char *rest;
+	FILE *file;
+	int count = 0;
+
+	memset(servers, 0, DNS_SERVERS * sizeof(struct sockaddr_in));
+
+	if (env && *env) {
+		strncpy(line, env, sizeof(line) - 1);
+		line[sizeof(line) - 1] = 0;
+		servers[0].sin_family = AF_INET;
+		servers[0].sin_port = htons(53);
+		if ((word = strchr(line, ':'))) {
+			*word++ = 0;
+			servers[0].sin_port = htons(cast(u16, atoi(word)));
+		}
+		return inet_pton(AF_INET, line, &servers[0].sin_addr) == 1 ? 1 : 0;
+	}
+
+	if (!(file = fopen("/etc/resolv.conf", "r"))) return 0;
+
+	while (count < DNS_SERVERS && fgets(line, sizeof(line), file)) {
+		word = strtok_r(line, " \t\r\n", &rest);
+		if (!word || strcmp(word, "nameserver") != 0) continue;
+
+		word = strtok_r(NULL, " \t\r\n", &rest);
+		if (!word || inet_pton(AF_INET, word, &servers[count].sin_addr) != 1)
+			continue; // (IPv6 servers are not used)
+
+		servers[count].sin_family = AF_INET;
+		servers[count].sin_port = htons(53);
+		count++;
+	}
+
+	fclose(file);
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static int Read_DNS_Name(const REBYTE *msg, int len, int at, char *out)
+/*
+**		Read the (possibly compressed) name at the offset into out,
+**		in dotted form, which must have room for NI_MAXHOST chars.
+**		Returns the offset just past the name, or -1 if it is bad.
+**
+***********************************************************************/
+{
+	int end = -1;	// where the name ends, once a pointer is followed
+	int jumps = 0;
+	int size = 0;
+	int n;
+
+	for (;;) {
+		if (at >= len) return -1;
+		n = msg[at];
+
+		if (n == 0) {
+			at++;
+			break;
+		}
+
+		if ((n & 0xC0) == 0xC0) {
+			if (at + 1 >= len || ++jumps > 16) return -1;
+			if (end < 0) end = at + 2;
+			at = ((n & 0x3F) << 8) | msg[at + 1];
+			continue;
+		}
+
+		if ((n & 0xC0) != 0 || at + 1 + n > len) return -1;
+		if (size + n + 2 > NI_MAXHOST) return -1;
+
+		if (size > 0) out[size++] = '.';
+		memcpy(out + size, msg + at + 1, n);
+		size += n;
+		at += 1 + n;
+	}
+
+	out[size] = 0;
+	return end < 0 ? at : end;
+}
+
+
+/***********************************************************************
+**
+*/	static int Make_DNS_Query(REBYTE *msg, const char *name, u16 id)
+/*
+**		Make a recursive query for the A record of the name.
+**		Returns the length of the message, or 0 if the name is bad.
+**
+***********************************************************************/
+{
+	int at = 12;
+	int n;
+
+	memset(msg, 0, 12);
+	msg[0] = cast(REBYTE, id >> 8);
+	msg[1] = cast(REBYTE, id);
+	msg[2] = 0x01;	// RD: recursion desired
+	msg[5] = 1;		// one question
+
+	while (*name) {
+		for (n = 0; name[n] && name[n] != '.'; n++);
+		if (n == 0 || n > 63 || at + n + 1 > 12 + 255) return 0;
+
+		msg[at++] = cast(REBYTE, n);
+		memcpy(msg + at, name, n);
+		at += n;
+		name += n;
+		if (*name == '.') name++;
+	}
+
+	msg[at++] = 0;
+	msg[at++] = 0;
+	msg[at++] = DNS_TYPE_A;
+	msg[at++] = 0;
+	msg[at++] = DNS_CLASS_IN;
+	return at;
+}
+
+
+/***********************************************************************
+**
+*/	static int Parse_DNS_Answer(const REBYTE *msg, int len, const char *name, u32 *ip, u32 *ttl)
+/*
+**		Find the address of the name in the answer, following CNAME
+**		records.  The TTL is the shortest one on the way to it.
+**
+**		Returns 1 if found, 0 if the answer says there is no such
+**		address (or is bad), -1 if another server should be asked.
+**
+***********************************************************************/
+{
+	char current[NI_MAXHOST];
+	char owner[NI_MAXHOST];
+	int qdcount = (msg[4] << 8) | msg[5];
+	int ancount = (msg[6] << 8) | msg[7];
+	int rcode = msg[3] & 0x0F;
+	int answers;
+	int hops;
+	int at;
+	int n;
+	u16 type;
+	u16 class;
+	u32 rr_ttl;
+	u16 rdlen;
+
+	if (rcode == 3) return 0;	// NXDOMAIN: no such name
+	if (rcode != 0) return -1;	// SERVFAIL, REFUSED...
+
+	at = 12;
+	for (n = 0; n < qdcount; n++) {
+		if ((at = Read_DNS_Name(msg, len, at, owner)) < 0) return 0;
+		at += 4;
+	}
+	answers = at;
+
+	strncpy(current, name, NI_MAXHOST - 1);
+	current[NI_MAXHOST - 1] = 0;
+	*ttl = DNS_MAX_TTL;
+
+	// Each pass looks for the current name, which a CNAME changes
+	for (hops = 0; hops < 8; hops++) {
+		REBOOL aliased = FALSE;
+
+		at = answers;
+		for (n = 0; n < ancount && !aliased; n++) {
+			if ((at = Read_DNS_Name(msg, len, at, owner)) < 0) return 0;
+			if (at + 10 > len) return 0;
+
+			type = (msg[at] << 8) | msg[at + 1];
+			class = (msg[at + 2] << 8) | msg[at + 3];
+			rr_ttl = (cast(u32, msg[at + 4]) << 24) | (msg[at + 5] << 16)
+				| (msg[at + 6] << 8) | msg[at + 7];
+			rdlen = (msg[at + 8] << 8) | msg[at + 9];
+			at += 10;
+			if (at + rdlen > len) return 0;
+
+			if (class == DNS_CLASS_IN && strcasecmp(owner, current) == 0) {
+				if (rr_ttl < *ttl) *ttl = rr_ttl;
+
+				if (type == DNS_TYPE_A && rdlen == 4) {
+					memcpy(ip, msg + at, 4);
+					return 1;
+				}
+				if (type == DNS_TYPE_CNAME) {
+					if (Read_DNS_Name(msg, len, at, current) < 0) return 0;
+					aliased = TRUE;
+				}
+			}
+			at += rdlen;
+		}
+
+		if (!aliased) break;
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Random_Query_Id(u16 *id)
+/*
+**		A query ID that an off-path sender can't guess (it and the
+**		source port are all that tie an answer to its query).
+**
+***********************************************************************/
+{
+	int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+	REBOOL ok;
+
+	if (fd < 0) return FALSE;
+	ok = (read(fd, id, sizeof(*id)) == sizeof(*id));
+	close(fd);
+	return ok;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Answers_Query(const REBYTE *answer, int len, const REBYTE *query, int query_len)
+/*
+**		Is this a response to the query: the same ID, and the same one
+**		question (the name's case may differ, as some servers change
+**		it)?  Answers to anything else are ignored.
+**
+***********************************************************************/
+{
+	int n;
+
+	if (len < query_len || !(answer[2] & 0x80)) return FALSE; // QR bit
+	if (answer[0] != query[0] || answer[1] != query[1]) return FALSE;
+	if (answer[4] != 0 || answer[5] != 1) return FALSE; // QDCOUNT
+
+	// (label lengths are under 64, so tolower() leaves them alone)
+	for (n = 12; n < query_len; n++) {
+		if (tolower(answer[n]) != tolower(query[n])) return FALSE;
+	}
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Query_DNS(const char *name, u32 *ip, u32 *ttl)
+/*
+**		Ask the name servers for the address of the name.
+**		Returns FALSE if no answer with an address was had.
+**
+***********************************************************************/
+{
+	struct sockaddr_in servers[DNS_SERVERS];
+	int num_servers = Get_Name_Servers(&servers[0]);
+	REBYTE query[DNS_MAX_MSG];
+	REBYTE answer[DNS_MAX_MSG];
+	struct pollfd pfd;
+	int query_len;
+	int len;
+	int result;
+	int tries;
+	int n;
+	u16 id;
+	int sock;
+
+	// Without a good ID, leave it to the system resolver
+	if (!Random_Query_Id(&id)) return FALSE;
+	if (!(query_len = Make_DNS_Query(query, name, id))) return FALSE;
+
+	for (tries = 0; tries < DNS_TRIES; tries++) {
+		for (n = 0; n < num_servers; n++) {
+			sock = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+			if (sock < 0) return FALSE;
+
+			if (
+				connect(
+					sock, cast(struct sockaddr*, &servers[n]), sizeof(servers[n])
+				) < 0
+				|| send(sock, query, query_len, 0) != query_len
+			) {
+				close(sock);
+				continue;
+			}
+
+			// Wait for the answer to this query (ignoring stray ones)
+			result = -1;
+			pfd.fd = sock;
+			pfd.events = POLLIN;
+			while (poll(&pfd, 1, DNS_TIMEOUT) > 0) {
+				len = recv(sock, answer, sizeof(answer), 0);
+				if (len < 0) break;
+				if (!Answers_Query(answer, len, query, query_len)) continue;
+				result = Parse_DNS_Answer(answer, len, name, ip, ttl);
+				break;
+			}
+			close(sock);
+
+			if (result >= 0) return (result == 1) ? TRUE : FALSE;
+		}
+	}
+
+	return FALSE;
+}
+
+
+/***********************************************************************
+**
+*/	static void Run_Job(REBRSV *job)
+/*
+**		Do the lookup (on a helper thread).
+**
+***********************************************************************/
+{
+	struct addrinfo hints;
+	struct addrinfo *info;
+	struct sockaddr_in sa;
+	u32 ttl;
+
+	if (job->reverse) {
+		memset(&sa, 0, sizeof(sa));
+		sa.sin_family = AF_INET;
+		sa.sin_addr.s_addr = job->ip;
+		job->error = getnameinfo(
+			cast(struct sockaddr*, &sa), sizeof(sa),
+			job->name, sizeof(job->name), NULL, 0, NI_NAMEREQD
+		);
+		return;
+	}
+
+	job->error = 0;
+	if (Find_In_Hosts(job->name, &job->ip)) return;
+
+	// A name without a dot may be meant for the search list, which is
+	// left to the system resolver.
+	if (strchr(job->name, '.') && Query_DNS(job->name, &job->ip, &ttl)) {
+		pthread_mutex_lock(&Resolve_Lock);
+		Cache_Name(job->name, job->ip, ttl);
+		pthread_mutex_unlock(&Resolve_Lock);
+		return;
+	}
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+	job->error = getaddrinfo(job->name, NULL, &hints, &info);
+	if (job->error) return;
+
+	memcpy(
+		&job->ip,
+		&cast(struct sockaddr_in*, info->ai_addr)->sin_addr.s_addr,
+		4
+	);
+	freeaddrinfo(info);
+}
+
+
+/***********************************************************************
+**
+*/	static void *Resolver_Thread(void *arg)
+/*
+**		Take lookups from the queue and run them, for good.
+**
+***********************************************************************/
+{
+	REBRSV *job;
+
+	for (;;) {
+		pthread_mutex_lock(&Resolve_Lock);
+		while (!Queue_Head) {
+			Idle_Resolvers++;
+			pthread_cond_wait(&Resolve_Work, &Resolve_Lock);
+			Idle_Resolvers--;
+		}
+		job = Queue_Head;
+		Queue_Head = job->next;
+		if (!Queue_Head) Queue_Tail = 0;
+		Queue_Length--;
+		pthread_mutex_unlock(&Resolve_Lock);
+
+		Run_Job(job);
+
+		pthread_mutex_lock(&Resolve_Lock);
+		if (job->abandoned)
+			OS_FREE(job);
+		else
+			job->state = job->error ? RESOLVE_FAILED : RESOLVE_DONE;
+		pthread_mutex_unlock(&Resolve_Lock);
+
+		// Wake up a WAIT (if the pipe is full, it will wake anyway)
+		if (Wake_Fds[1] >= 0 && write(Wake_Fds[1], "", 1) < 0) NOOP;
+	}
+
+	return NULL;
+}
+
+
+/***********************************************************************
+**
+*/	static REBOOL Start_Resolver(void)
+/*
+**		Lock must be held.
+**
+***********************************************************************/
+{
+	pthread_attr_t attr;
+	pthread_t thread;
+	sigset_t all;
+	sigset_t old;
+	int result;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	// The thread must not take signals meant for the interpreter (or
+	// for a signal port), so it starts with all of them blocked.
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	result = pthread_create(&thread, &attr, Resolver_Thread, NULL);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	pthread_attr_destroy(&attr);
+
+	if (result != 0) return FALSE;
+	Num_Resolvers++;
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	int Resolver_Wake_Fd(void)
+/*
+**		The file descriptor that becomes readable when a lookup has
+**		finished, for the network device to wait on.  -1 if none.
+**
+***********************************************************************/
+{
+	int n;
+
+	if (Wake_Fds[0] < 0) {
+		if (pipe(Wake_Fds) < 0) {
+			Wake_Fds[0] = Wake_Fds[1] = -1;
+			return -1;
+		}
+		for (n = 0; n < 2; n++) {
+			fcntl(Wake_Fds[n], F_SETFL, O_NONBLOCK);
+			fcntl(Wake_Fds[n], F_SETFD, FD_CLOEXEC);
+		}
+	}
+	return Wake_Fds[0];
+}
+
+
+/***********************************************************************
+**
+*/	void Drain_Resolver_Wakes(void)
+/*
+***********************************************************************/
+{
+	char buf[64];
+	while (read(Wake_Fds[0], buf, sizeof(buf)) > 0);
+}
+
+
+/***********************************************************************
+**
+*/	void *Resolve_Start(const char *host, u32 ip, REBOOL reverse)
+/*
+**		Start finding the address of a host name (or the name of an
+**		address, if reverse).  Returns the lookup for Resolve_Poll(),
+**		which may already be done, or NULL if out of memory.
+**
+***********************************************************************/
+{
+	REBRSV *job = OS_ALLOC_ZEROFILL(REBRSV);
+	struct in_addr addr;
+
+	if (!job) return NULL;
+
+	job->reverse = reverse;
+	job->ip = ip;
+	job->state = RESOLVE_PENDING;
+
+	if (!reverse) {
+		if (strlen(host) >= sizeof(job->name)) {
+			job->error = EAI_NONAME;
+			job->state = RESOLVE_FAILED;
+			return job;
+		}
+		strcpy(job->name, host);
+
+		// A trailing dot only says that the name is absolute
+		if (job->name[0] && job->name[strlen(job->name) - 1] == '.')
+			job->name[strlen(job->name) - 1] = 0;
+
+		if (inet_pton(AF_INET, job->name, &addr) == 1) {
+			job->ip = addr.s_addr;
+			job->state = RESOLVE_DONE;
+			return job;
+		}
+	}
+
+	pthread_mutex_lock(&Resolve_Lock);
+
+	if (!reverse && Find_Cached_Name(job->name, &job->ip)) {
+		job->state = RESOLVE_DONE;
+		pthread_mutex_unlock(&Resolve_Lock);
+		return job;
+	}
+
+	// Start another helper unless there are idle ones for all of the
+	// queued lookups.  (A helper only stops counting as idle once it has
+	// woken up, so a burst of lookups would otherwise all be queued up
+	// behind the one helper that was idle when it began.)
+	if (
+		Queue_Length >= Idle_Resolvers
+		&& Num_Resolvers < MAX_RESOLVERS
+		&& !Start_Resolver()
+		&& Num_Resolvers == 0
+	) {
+		// No thread to do it, so do it here (blocking, as it used to)
+		pthread_mutex_unlock(&Resolve_Lock);
+		Run_Job(job);
+		job->state = job->error ? RESOLVE_FAILED : RESOLVE_DONE;
+		return job;
+	}
+
+	if (Queue_Tail) Queue_Tail->next = job;
+	else Queue_Head = job;
+	Queue_Tail = job;
+	Queue_Length++;
+	pthread_cond_signal(&Resolve_Work);
+
+	pthread_mutex_unlock(&Resolve_Lock);
+	return job;
+}
+
+
+/***********************************************************************
+**
+*/	int Resolve_Poll(void *lookup, u32 *ip, char **name, int *error)
+/*
+**		Returns 1 if the lookup is still running, else 0 if it found
+**		the address (or the name, which belongs to the lookup) or -1
+**		if it failed with the error code given.
+**
+***********************************************************************/
+{
+	REBRSV *job = cast(REBRSV*, lookup);
+	int state;
+
+	pthread_mutex_lock(&Resolve_Lock);
+	state = job->state;
+	pthread_mutex_unlock(&Resolve_Lock);
+
+	if (state == RESOLVE_DONE) {
+		if (ip) *ip = job->ip;
+		if (name) *name = job->name;
+	}
+	else if (state == RESOLVE_FAILED)
+		*error = job->error;
+
+	return state;
+}
+
+
+/***********************************************************************
+**
+*/	void Resolve_Free(void *lookup)
+/*
+**		Free a lookup, which is abandoned if it has not finished.
+**
+***********************************************************************/
+{
+	REBRSV *job = cast(REBRSV*, lookup);
+	REBRSV **prior;
+
+	pthread_mutex_lock(&Resolve_Lock);
+
+	if (job->state != RESOLVE_PENDING) {
+		OS_FREE(job);
+		pthread_mutex_unlock(&Resolve_Lock);
+		return;
+	}
+
+	// Not yet taken up by a helper, so it need never be run:
+	for (prior = &Queue_Head; *prior; prior = &(*prior)->next) {
+		if (*prior == job) {
+			*prior = job->next;
+			if (Queue_Tail == job) {
+				for (Queue_Tail = Queue_Head; Queue_Tail && Queue_Tail->next;)
+					Queue_Tail = Queue_Tail->next;
+			}
+			OS_FREE(job);
+			pthread_mutex_unlock(&Resolve_Lock);
+			return;
+		}
+	}
+
+	job->abandoned = TRUE;
+	pthread_mutex_unlock(&Resolve_Lock);
+}
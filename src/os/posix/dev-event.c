@@ -46,6 +46,10 @@
 
 extern void Done_Device(REBUPT handle, int error);
 
+#ifdef HAS_EPOLL
+extern int Wait_Net_Events(REBCNT millisec);
+#endif
+
 /***********************************************************************
 **
 */	DEVICE_CMD Init_Events(REBREQ *dr)
@@ -90,6 +94,13 @@ extern void Done_Device(REBUPT handle, int error);
 	struct timeval tv;
 	int result;
 
+#ifdef HAS_EPOLL
+	// Sleep on the network device's epoll set, so that socket activity
+	// ends the wait at once instead of at the end of the timer period.
+	// (If networking is not initialized, use the select() timer below.)
+	if (Wait_Net_Events(req->length) >= 0) return DR_DONE;
+#endif
+
 	tv.tv_sec = 0;
 	tv.tv_usec = req->length * 1000;
 	//printf("usec %d\n", tv.tv_usec);
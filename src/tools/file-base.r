@@ -40,6 +40,7 @@ core: [
 	d-crash.c
 	d-dump.c
 	d-print.c
+	d-profile.c
 	f-blocks.c
 	f-deci.c
 	f-dtoa.c
@@ -67,7 +68,9 @@ core: [
 	n-sets.c
 	n-strings.c
 	n-system.c
+	p-checksum.c
 	p-clipboard.c
+	p-compress.c
 	p-console.c
 	p-dir.c
 	p-dns.c
@@ -269,6 +272,9 @@ os-linux: [
 
 	; Linux supports siginfo_t-style signals
 	linux/dev-signal.c
+
+	; Host name lookups run on helper threads
+	linux/host-resolve.c
 ]
 ; cloned from os-linux TODO: check'n'fix !!
 os-android: [ 
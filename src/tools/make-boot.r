@@ -1149,7 +1149,7 @@ for-each type datatypes [
 	append/only boot-typespecs select specs type
 ]
 
-;-- Create main code section (compressed):
+;-- Create main code section (pre-scanned image):
 boot-types: new-types
 boot-root: load %root.r
 boot-task: load %task.r
@@ -1159,34 +1159,101 @@ boot-ops: load %ops.r
 write %boot-code.r mold reduce sections
 data: mold/flat reduce sections
 insert data reduce ["; Copyright (C) REBOL Technologies " now newline]
-insert tail data make char! 0 ; scanner requires zero termination
 
-comp-data: compress data: to-binary data
+;-- Rather than have every startup scan DATA (it used to be embedded as
+;-- compressed text), it is scanned here and the block is written out as
+;-- an image that Load_Boot() turns straight into values.  Words refer to
+;-- a table of spellings, kept in the order the scanner would first have
+;-- met them, so the symbol numbers come out the same as from the text.
+;-- See Load_Boot_Value() in b-init.c for the layout of each value.
+
+image: make binary! 200000
+image-words: make binary! 50000
+image-word-map: make map! 4000
+image-word-count: 0
+
+image-count: func [bin [binary!] n [integer!]] [
+	; 7 bits at a time, low bits first, top bit set if more follow
+	while [n >= 128] [
+		append bin 128 + (n // 128)
+		n: shift n -7
+	]
+	append bin n
+]
+
+image-word: func [spelling [binary!] /local n] [
+	unless n: select image-word-map spelling [
+		n: image-word-count
+		image-word-count: image-word-count + 1
+		append image-word-map reduce [spelling n]
+		image-count image-words length? spelling
+		append image-words spelling
+	]
+	n
+]
+
+image-value: func [blk [any-block!] /local value type bin] [
+	value: first blk
+	type: form type? :value
+	type: to word! copy/part type back tail type ; no "!"
+	type: -1 + index? find datatypes type
+	if all [not any-path? blk new-line? blk] [type: type + 128]
+	append image type
+
+	case [
+		any-word? :value [
+			image-count image image-word to binary! to string! to word! :value
+		]
+		any-block? :value [
+			image-count image length? value
+			while [not tail? value] [
+				image-value value
+				value: next value
+			]
+		]
+		string? :value [
+			bin: to binary! value
+			image-count image length? bin
+			append image bin
+		]
+		integer? :value [
+			append image to binary! value
+		]
+		true [
+			bin: to binary! mold/flat :value
+			image-count image length? bin
+			append image bin
+			append image 0 ; scanner requires zero termination
+		]
+	]
+]
+
+; The outer block is what scanning the whole of DATA would give
+image-value reduce [load/all data]
+insert image image-words
+insert image head image-count copy #{} image-word-count
 
 emit [
 {
-// Native_Specs contains data which is the DEFLATE-algorithm-compressed
-// representation of the textual function specs for Rebol's native
-// routines.  Though DEFLATE includes the compressed size in the payload,
-// NAT_UNCOMPRESSED_SIZE is also defined to be used as a sanity check
-// on the decompression process.
+// Boot_Image holds the boot block, already scanned by make-boot.r, for
+// Load_Boot() to make into values.  It is the function specs for the
+// native routines and the rest of the startup code (see boot-code.r).
 }
 newline
 ]
 
-emit ["const REBYTE Native_Specs[NAT_COMPRESSED_SIZE] = {" newline]
+emit ["const REBYTE Boot_Image[BOOT_IMAGE_SIZE] = {" newline]
 
-;-- Convert UTF-8 binary to C-encoded string:
-emit binary-to-c comp-data
+;-- Convert image binary to C-encoded string:
+emit binary-to-c image
 emit-end/easy
 
 write src/b-boot.c out
 
 ;-- Output stats:
 print [
-	"Compressed" length data "to" length comp-data "bytes:"
-	to-integer ((length comp-data) / (length data) * 100)
-	"percent of original"
+	"Boot image:" length? image "bytes," image-word-count "words (text was"
+	length? data "bytes)"
 ]
 
 ;-- Create platform string:
@@ -1210,11 +1277,10 @@ emit-head "Bootstrap Structure and Root Module" %boot.h
 emit [
 {
 #define MAX_NATS      } nat-count {
-#define NAT_UNCOMPRESSED_SIZE } length data {
-#define NAT_COMPRESSED_SIZE } length comp-data {
+#define BOOT_IMAGE_SIZE } length image {
 #define CHECK_TITLE   } checksum to binary! title {
 
-extern const REBYTE Native_Specs[];
+extern const REBYTE Boot_Image[];
 extern const REBFUN Native_Funcs[];
 
 typedef struct REBOL_Boot_Block ^{
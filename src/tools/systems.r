@@ -53,40 +53,40 @@ systems: [
 			[LLP64 LEN LL? +O2 UNI W32 CON S4M EXE DIR -LM]
 	;-------------------------------------------------------------------------
 	0.4.02		linux-x86		linux
-			[LEN LLC +O2 LDL ST1 -LM LC23]
+			[LEN LLC +O2 LDL PTH ST1 -LM LC23]
 
 	0.4.03		linux-x86		linux
-			[LEN LLC +O2 HID LDL ST1 -LM LC25]
+			[LEN LLC +O2 HID LDL PTH ST1 -LM LC25]
 
 	0.4.04		linux-x86		linux
-			[M32 LEN LLC +O2 HID LDL ST1 -LM LC211]
+			[M32 LEN LLC +O2 HID LDL PTH ST1 -LM LC211]
 
 	0.4.10		linux-ppc		linux
-			[BEN LLC +O1 HID LDL ST1 -LM]
+			[BEN LLC +O1 HID LDL PTH ST1 -LM]
 
 	0.4.11		linux-ppc64		linux
-			[LP64 BEN LLC +O1 HID LDL ST1 -LM]
+			[LP64 BEN LLC +O1 HID LDL PTH ST1 -LM]
 
 	0.4.20		linux-arm		linux
-			[LEN LLC +O2 HID LDL ST1 -LM]
+			[LEN LLC +O2 HID LDL PTH ST1 -LM]
 
 	0.4.21		linux-arm		linux
-			[LEN LLC +O2 HID LDL ST1 -LM PIE LCB]
+			[LEN LLC +O2 HID LDL PTH ST1 -LM PIE LCB]
 
 	0.4.30		linux-mips		linux
-			[LEN LLC +O2 HID LDL ST1 -LM]
+			[LEN LLC +O2 HID LDL PTH ST1 -LM]
 
 	0.4.31		linux-mips32be	linux
-			[BEN LLC +O2 HID LDL ST1 -LM]
+			[BEN LLC +O2 HID LDL PTH ST1 -LM]
 
 	0.4.40		linux-x64		linux
-			[LP64 LEN LLC +O2 HID LDL ST1 -LM]
+			[LP64 LEN LLC +O2 HID LDL PTH ST1 -LM]
 
 	0.4.60		linux-axp		linux
-			[LP64 LEN LLC +O2 HID LDL ST1 -LM]
+			[LP64 LEN LLC +O2 HID LDL PTH ST1 -LM]
 
 	0.4.61		linux-ia64		linux
-			[LP64 LEN LLC +O2 HID LDL ST1 -LM]
+			[LP64 LEN LLC +O2 HID LDL PTH ST1 -LM]
 	;-------------------------------------------------------------------------
 	0.5.75		haiku			posix
 			[LEN LLC +O2 ST1 NWK]
@@ -113,7 +113,7 @@ systems: [
 			[LEN LLC +O2 HID LDL ST1 -LM LC25]
 
 	0.14.02		syllable-svr	linux
-			[M32 LEN LLC +O2 HID LDL ST1 -LM LC211]
+			[M32 LEN LLC +O2 HID LDL PTH ST1 -LM LC211]
 ]
 
 compiler-flags: context [
@@ -149,6 +149,7 @@ linker-flags: context [
 
 	NSO: ""							; no shared libs
 	LDL: "-ldl"						; link with dynamic lib lib
+	PTH: "-lpthread"				; link with POSIX threads lib
 	LLOG: "-llog"					; on Android, link with liblog.so
 
 	W32: "-lwsock32 -lcomdlg32"